@@ -0,0 +1,17 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Declares the custom collision channels and profiles of Echoes of the Ancients.
+// The channels are configured in Config/DefaultEngine.ini; keep both in sync.
+
+#pragma once
+
+#include "Engine/EngineTypes.h"
+
+/// Object channel of hurtbox shapes, the only shapes weapon queries touch.
+#define ECC_AEOA_Hurtbox ECC_GameTraceChannel1
+
+/// Object channel of weapon boxes, only overlapped by hurtbox shapes; used by weapons without continuous collision.
+#define ECC_AEOA_WeaponBox ECC_GameTraceChannel2
+
+/// Collision profile of hurtbox shapes: query only, Hurtbox object type, ignoring every channel but WeaponBox,
+/// so hurtbox overlap updates only ever find weapon boxes.
+#define AEOA_PROFILE_HURTBOX FName(TEXT("Hurtbox"))
@@ -0,0 +1,9 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Declares the stat group shared by the gameplay subsystems of Echoes of the Ancients.
+// Use "stat EchoesOfTheAncients" in the console to display every counter in this group.
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Echoes of the Ancients"), STATGROUP_EchoesOfTheAncients, STATCAT_Advanced);
@@ -10,10 +10,16 @@ public class EchoesOfTheAncients : ModuleRules
 	
 		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "HairStrandsCore", "Niagara", "MetasoundEngine", "GeometryCollectionEngine", "UMG" });
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		PrivateDependencyModuleNames.AddRange(new string[] { "FieldSystemEngine", "AudioExtensions" });
 
-		// Uncomment if you are using Slate UI
-		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
+		// Blade trajectory baking samples animation poses in the editor
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("AnimationBlueprintLibrary");
+		}
+
+		// Slate UI, used by the batched health bar layer
+		PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
 		
 		// Uncomment if you are using online features
 		// PrivateDependencyModuleNames.Add("OnlineSubsystem");
@@ -3,4 +3,6 @@
 #include "EchoesOfTheAncients.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogEchoesOfTheAncients);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, EchoesOfTheAncients, "EchoesOfTheAncients" );
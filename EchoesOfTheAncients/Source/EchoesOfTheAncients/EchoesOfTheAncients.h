@@ -4,3 +4,6 @@
 
 #include "CoreMinimal.h"
 
+/// Log category for gameplay systems of Echoes of the Ancients (pools, subsystems, console dumps).
+ECHOESOFTHEANCIENTS_API DECLARE_LOG_CATEGORY_EXTERN(LogEchoesOfTheAncients, Log, All);
+
@@ -3,8 +3,12 @@
 // destruction logic for breakable objects in Echoes of the Ancients.
 
 #include "Breakables/AEOA_BreakableActor.h"
+#include "Combat/AEOA_HittableGridSubsystem.h"
 #include "GeometryCollection/GeometryCollectionComponent.h"
+#include "Items/AEOA_CoinBurst.h"
+#include "Items/AEOA_LootStreamingSubsystem.h"
 #include "Items/AEOA_Treasure.h"
+#include "Components/AEOA_HurtboxComponent.h"
 #include "Components/CapsuleComponent.h"
 
 AAEOA_BreakableActor::AAEOA_BreakableActor()
@@ -13,7 +17,7 @@ AAEOA_BreakableActor::AAEOA_BreakableActor()
 
 	GeometryCollection = CreateDefaultSubobject<UGeometryCollectionComponent>(TEXT("GeometryCollection"));
 	SetRootComponent(GeometryCollection);
-	GeometryCollection->SetGenerateOverlapEvents(true);
+	GeometryCollection->SetGenerateOverlapEvents(false);
 	GeometryCollection->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);
 	GeometryCollection->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Block);
 
@@ -21,12 +25,89 @@ AAEOA_BreakableActor::AAEOA_BreakableActor()
 	Capsule->SetupAttachment(GetRootComponent());
 	Capsule->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
 	Capsule->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Ignore);
+
+	// Without shapes, the hurtbox matches the capsule.
+	Hurtbox = CreateDefaultSubobject<UAEOA_HurtboxComponent>(TEXT("Hurtbox"));
+	Hurtbox->SetupAttachment(GetRootComponent());
+}
+
+void AAEOA_BreakableActor::PostLoad()
+{
+	Super::PostLoad();
+
+	// Older instances referenced their loot with hard class pointers, which loaded it with the map.
+	if (TreasureClass_DEPRECATED)
+	{
+		MigrateLootClass(TreasureClass_DEPRECATED.Get(), false);
+		TreasureClass_DEPRECATED = nullptr;
+	}
+	if (CoinBurstClass_DEPRECATED)
+	{
+		MigrateLootClass(CoinBurstClass_DEPRECATED.Get(), true);
+		CoinBurstClass_DEPRECATED = nullptr;
+	}
+}
+
+// Placed instances inherit the LootTable their archetype already migrated; an instance that also saved
+// its own deprecated class replaces the inherited entry instead of adding a second one.
+void AAEOA_BreakableActor::MigrateLootClass(UClass* OldClass, bool bGuaranteed)
+{
+	const bool bAlreadyMigrated = LootTable.ContainsByPredicate([OldClass](const FAEOA_LootEntry& Entry)
+	{
+		return Entry.LootClass.ToSoftObjectPath() == FSoftObjectPath(OldClass);
+	});
+	if (bAlreadyMigrated) return;
+
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		if (const AAEOA_BreakableActor* Archetype = Cast<AAEOA_BreakableActor>(GetArchetype()))
+		{
+			FAEOA_LootEntry* Inherited = LootTable.FindByPredicate([Archetype, bGuaranteed](const FAEOA_LootEntry& Entry)
+			{
+				return Entry.bGuaranteed == bGuaranteed && Archetype->LootTable.ContainsByPredicate([&Entry](const FAEOA_LootEntry& ArchetypeEntry)
+				{
+					return ArchetypeEntry.bGuaranteed == Entry.bGuaranteed && ArchetypeEntry.LootClass == Entry.LootClass;
+				});
+			});
+			if (Inherited)
+			{
+				Inherited->LootClass = OldClass;
+				return;
+			}
+		}
+	}
+
+	FAEOA_LootEntry& Entry = LootTable.AddDefaulted_GetRef();
+	Entry.LootClass = OldClass;
+	Entry.bGuaranteed = bGuaranteed;
 }
 
 void AAEOA_BreakableActor::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	if (UAEOA_LootStreamingSubsystem* LootSubsystem = GetWorld()->GetSubsystem<UAEOA_LootStreamingSubsystem>())
+	{
+		LootSubsystem->RegisterSource(this, LootTable);
+	}
+	if (UAEOA_HittableGridSubsystem* HittableGrid = GetWorld()->GetSubsystem<UAEOA_HittableGridSubsystem>())
+	{
+		HittableGrid->RegisterHittable(this, false);
+	}
+}
+
+void AAEOA_BreakableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAEOA_LootStreamingSubsystem* LootSubsystem = GetWorld()->GetSubsystem<UAEOA_LootStreamingSubsystem>())
+	{
+		LootSubsystem->UnregisterSource(this);
+	}
+	if (UAEOA_HittableGridSubsystem* HittableGrid = GetWorld()->GetSubsystem<UAEOA_HittableGridSubsystem>())
+	{
+		HittableGrid->UnregisterHittable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AAEOA_BreakableActor::Tick(float DeltaTime)
@@ -39,12 +120,52 @@ void AAEOA_BreakableActor::GetHit_Implementation(const FVector& ImpactPoint)
 {
 	if (bBroken) return;
 	bBroken = true;
+	Hurtbox->SetHurtboxEnabled(false);
+	if (UAEOA_HittableGridSubsystem* HittableGrid = GetWorld()->GetSubsystem<UAEOA_HittableGridSubsystem>())
+	{
+		HittableGrid->UnregisterHittable(this);
+	}
+
+	UAEOA_LootStreamingSubsystem* LootSubsystem = GetWorld()->GetSubsystem<UAEOA_LootStreamingSubsystem>();
+	if (!LootSubsystem) return;
+
+	FVector Location = GetActorLocation();
+	Location.Z += LootSpawnHeight;
+
+	// Spawns are deferred by the subsystem if the loot class has not finished loading yet.
+	for (const FAEOA_LootEntry& Entry : LootTable)
+	{
+		if (Entry.bGuaranteed)
+		{
+			LootSubsystem->SpawnLoot(Entry.LootClass, Location, GetActorRotation());
+		}
+	}
+	if (const FAEOA_LootEntry* Rolled = RollWeightedLoot())
+	{
+		LootSubsystem->SpawnLoot(Rolled->LootClass, Location, GetActorRotation());
+	}
+}
+
+const FAEOA_LootEntry* AAEOA_BreakableActor::RollWeightedLoot() const
+{
+	float TotalWeight = 0.f;
+	for (const FAEOA_LootEntry& Entry : LootTable)
+	{
+		if (!Entry.bGuaranteed && Entry.Weight > 0.f)
+		{
+			TotalWeight += Entry.Weight;
+		}
+	}
+	if (TotalWeight <= 0.f) return nullptr;
 
-	UWorld* World = GetWorld();
-	if (World && TreasureClass)
+	float Roll = FMath::FRandRange(0.f, TotalWeight);
+	const FAEOA_LootEntry* Rolled = nullptr;
+	for (const FAEOA_LootEntry& Entry : LootTable)
 	{
-		FVector Location = GetActorLocation();
-		Location.Z += 75.f;
-		World->SpawnActor<AAEOA_Treasure>(TreasureClass, Location, GetActorRotation());
+		if (Entry.bGuaranteed || Entry.Weight <= 0.f) continue;
+		Rolled = &Entry;
+		Roll -= Entry.Weight;
+		if (Roll <= 0.f) break;
 	}
+	return Rolled;
 }
@@ -0,0 +1,53 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the FAEOA_MontageSectionTable struct, resolving montage
+// sections once and starting montages directly at a section.
+
+#include "Characters/AEOA_MontageSectionTable.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "EchoesOfTheAncients/EchoesOfTheAncients.h"
+
+// --- Init ---
+void FAEOA_MontageSectionTable::Init(TConstArrayView<FName> InSectionNames)
+{
+	SectionNames = InSectionNames;
+	Montage = FObjectKey();
+	SectionIndices.Reset();
+	StartTimes.Reset();
+}
+
+// --- Build ---
+void FAEOA_MontageSectionTable::Build(const UAnimMontage* InMontage)
+{
+	Montage = FObjectKey(InMontage);
+	SectionIndices.Reset();
+	StartTimes.Reset();
+	if (!InMontage) return;
+
+	for (const FName& SectionName : SectionNames)
+	{
+		const int32 SectionIndex = InMontage->GetSectionIndex(SectionName);
+		if (SectionIndex == INDEX_NONE)
+		{
+			UE_LOG(LogEchoesOfTheAncients, Warning, TEXT("Montage %s has no section %s, it will play from its start instead."), *InMontage->GetName(), *SectionName.ToString());
+		}
+		SectionIndices.Add(SectionIndex);
+		StartTimes.Add(SectionIndex != INDEX_NONE ? InMontage->GetAnimCompositeSection(SectionIndex).GetTime() : 0.f);
+	}
+}
+
+// --- Play ---
+// Starting the montage at the section’s start time replaces Montage_Play followed by Montage_JumpToSection,
+// which searched the montage sections by name on every call.
+bool FAEOA_MontageSectionTable::Play(UAnimInstance* AnimInstance, UAnimMontage* InMontage, int32 Entry, float PlayRate)
+{
+	if (!AnimInstance || !InMontage) return false;
+
+	if (Montage != FObjectKey(InMontage))
+	{
+		Build(InMontage);
+	}
+	// Missing sections start at 0, so the montage still plays from its start.
+	const float StartTime = StartTimes.IsValidIndex(Entry) ? StartTimes[Entry] : 0.f;
+	return AnimInstance->Montage_Play(InMontage, PlayRate, EMontagePlayReturnType::MontageLength, StartTime) > 0.f;
+}
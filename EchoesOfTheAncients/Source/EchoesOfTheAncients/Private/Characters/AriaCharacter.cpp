@@ -5,19 +5,30 @@
 #include "Characters/AriaCharacter.h"
 #include "Animation/AnimMontage.h"
 #include "Camera/CameraComponent.h"
+#include "Combat/AEOA_CombatLatencySubsystem.h"
 #include "Characters/CharacterTypes.h"
-#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GroomComponent.h"
 #include "Items/AEOA_Item.h"
+#include "Items/AEOA_PickupGridSubsystem.h"
 #include "Items/Weapons/AEOA_Weapon.h"
 
+// Section and socket names are built once at module load rather than on every attack or equip.
+static const FName AttackSectionNames[] = { FName("Attack1"), FName("Attack2"), FName("Attack3") };
+static const FName EquipSectionNames[] = { FName("Equip"), FName("UnEquip") };
+static const FName HandWeaponSocketName("R_hand_weapon");
+static const FName SpineWeaponSocketName("SpineSocket");
+
 // Sets default values
 AAriaCharacter::AAriaCharacter()
 {
+    AttackSections.Init(AttackSectionNames);
+    EquipSections.Init(EquipSectionNames);
+
 	// Enable ticking for this character
 	PrimaryActorTick.bCanEverTick = true;
 
@@ -70,18 +81,28 @@ void AAriaCharacter::BeginPlay()
             }
         }
     }
+
+    // Resolve the montage sections now rather than on the first attack.
+    AttackSections.Build(Attack_OneHandedWeapon);
+    EquipSections.Build(EquipMontage);
 }
 
 // --- SetWeaponCollisionEnabled ---
-// Sets the collision enabled state for the equipped weapon’s WeaponBox.
+// Opens or closes the collision window of the equipped weapon.
 void AAriaCharacter::SetWeaponCollisionEnabled(ECollisionEnabled::Type CollisionEnabled)
 {
-    // Check if a weapon is equipped and its WeaponBox exists before setting collision.
-    if (EquippedWeapon && EquippedWeapon->GetWeaponBox())
+    // Open or close the equipped weapon’s collision window; each window is a new swing.
+    if (EquippedWeapon)
     {
-        EquippedWeapon->GetWeaponBox()->SetCollisionEnabled(CollisionEnabled);
-        // Clear the IgnoreActors array when disabling collision to reset for the next attack.
-        EquippedWeapon->IgnoreActors.Empty();
+        EquippedWeapon->SetCollisionWindowEnabled(CollisionEnabled);
+
+        if (CollisionEnabled != ECollisionEnabled::NoCollision)
+        {
+            if (UAEOA_CombatLatencySubsystem* Latency = GetWorld()->GetSubsystem<UAEOA_CombatLatencySubsystem>())
+            {
+                Latency->MarkStage(this, EAEOA_AttackStage::CollisionOpen);
+            }
+        }
     }
 }
 
@@ -151,7 +172,7 @@ void AAriaCharacter::PickupItem()
     if (OverlappingWeapon)
     {
         // Equip the weapon if overlapping one.
-        OverlappingWeapon->Equip(GetMesh(), FName("R_hand_weapon"), this, this);  // Equip the weapon to Aria’s right hand socket.
+        OverlappingWeapon->Equip(GetMesh(), HandWeaponSocketName, this, this);  // Equip the weapon to Aria’s right hand socket.
         OverlappingItem = nullptr;  // Clear the overlapping item to prevent re-equipping the same weapon.
         EquippedWeapon = OverlappingWeapon;  // Store the equipped weapon.
         CharacterState = ECharacterState::ECS_EquippedOneHandedWeapon;  // Update Aria’s state to reflect she’s equipped a one-handed weapon.
@@ -161,20 +182,50 @@ void AAriaCharacter::PickupItem()
         // If not overlapping a weapon, check if we can disarm (unequip) the current weapon.
         if (CanDisarm())
         {
-            PlayEquipMontage(FName("UnEquip"));
+            PlayEquipMontage(false);
             CharacterState = ECharacterState::ECS_Unequipped;  // Set state to unequipped.
             ActionState = EActionState::EAS_EquippingWeapon;  // Set state to equipping to prevent movement.
         }
         // If we can’t disarm, check if we can arm (equip) the weapon from the back.
         else if (CanArm())
         {
-            PlayEquipMontage(FName("Equip"));
+            PlayEquipMontage(true);
             CharacterState = ECharacterState::ECS_EquippedOneHandedWeapon;  // Set state to equipped.
             ActionState = EActionState::EAS_EquippingWeapon;  // Set state to equipping to prevent movement.
         }
     }
 }
 
+// --- UpdatePickupCandidates ---
+// Replaces per-item sphere overlap events with one grid query, so a pile of coins
+// no longer fights over the single OverlappingItem pointer.
+void AAriaCharacter::UpdatePickupCandidates()
+{
+    OverlappingItem = nullptr;
+
+    UAEOA_PickupGridSubsystem* GridSubsystem = GetWorld()->GetSubsystem<UAEOA_PickupGridSubsystem>();
+    if (!GridSubsystem) return;
+
+    GridSubsystem->QueryCandidates(
+        GetActorLocation(),
+        GetActorForwardVector(),
+        GetCapsuleComponent()->GetScaledCapsuleRadius(),
+        GetCapsuleComponent()->GetScaledCapsuleHalfHeight(),
+        MaxPickupCandidates,
+        PickupCandidates
+    );
+
+    // Candidates that consume the contact (e.g., treasure) are collected; the best remaining one can be picked up.
+    for (AAEOA_Item* Candidate : PickupCandidates)
+    {
+        if (!IsValid(Candidate)) continue;
+        if (!Candidate->HandlePickupProximity(this) && !OverlappingItem)
+        {
+            OverlappingItem = Candidate;
+        }
+    }
+}
+
 /// Increments the Dawnspire count when a Dawnspire coin is collected, 
 /// tracking progress toward unlocking the Sanctum of Echoes.
 void AAriaCharacter::IncrementDawnspireCount()
@@ -190,6 +241,11 @@ void AAriaCharacter::Attack_OneHanded()
     // Only allow attacking if the character can attack (unoccupied and equipped).
     if (CanAttack_OneHandedWeapon())
     {
+        // Timestamp the accepted press, so the latency of each stage up to the impact can be measured.
+        if (UAEOA_CombatLatencySubsystem* Latency = GetWorld()->GetSubsystem<UAEOA_CombatLatencySubsystem>())
+        {
+            Latency->MarkStage(this, EAEOA_AttackStage::Input);
+        }
         PlayAttackMontage_OneHandedWeapon();
         // Set the action state to attacking to prevent spamming.
         ActionState = EActionState::EAS_Attacking;
@@ -208,37 +264,15 @@ bool AAriaCharacter::CanAttack_OneHandedWeapon()
 // Plays the one-handed attack montage with a random section.
 void AAriaCharacter::PlayAttackMontage_OneHandedWeapon()
 {
-    // Get the animation instance from the character’s mesh.
-    UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-
-    // Check if the anim instance and attack montage are valid before proceeding.
-    if (AnimInstance && Attack_OneHandedWeapon)
+    // Randomly select between Attack1, Attack2, and Attack3 sections (0, 1, or 2),
+    // and start the attack montage directly at the selected section.
+    const int32 Selection = FMath::RandRange(0, AttackSections.Num() - 1);
+    if (AttackSections.Play(GetMesh()->GetAnimInstance(), Attack_OneHandedWeapon, Selection))
     {
-        // Play the attack montage with default settings (play rate 1.0, start at 0.0, stop all other montages).
-        AnimInstance->Montage_Play(Attack_OneHandedWeapon);
-
-        // Randomly select between Attack1, Attack2, and Attack3 sections (0, 1, or 2).
-        const int32 Selection = FMath::RandRange(0, 2);
-        FName SectionName = FName();
-
-        // Set the section name based on the random selection.
-        switch (Selection)
+        if (UAEOA_CombatLatencySubsystem* Latency = GetWorld()->GetSubsystem<UAEOA_CombatLatencySubsystem>())
         {
-        case 0:
-            SectionName = FName("Attack1");
-            break;
-        case 1:
-            SectionName = FName("Attack2");
-            break;
-        case 2:
-            SectionName = FName("Attack3");
-            break;
-        default:
-            break;
+            Latency->MarkStage(this, EAEOA_AttackStage::MontageStart);
         }
-
-        // Jump to the selected section in the attack montage.
-        AnimInstance->Montage_JumpToSection(SectionName, Attack_OneHandedWeapon);
     }
 }
 
@@ -266,7 +300,7 @@ void AAriaCharacter::Disarm()
 {
     if (EquippedWeapon)
     {
-        EquippedWeapon->AttachMeshToSocket(GetMesh(), FName("SpineSocket"));
+        EquippedWeapon->AttachMeshToSocket(GetMesh(), SpineWeaponSocketName);
     }
 }
 
@@ -276,7 +310,7 @@ void AAriaCharacter::Arm()
 {
     if (EquippedWeapon)
     {
-        EquippedWeapon->AttachMeshToSocket(GetMesh(), FName("R_hand_weapon"));
+        EquippedWeapon->AttachMeshToSocket(GetMesh(), HandWeaponSocketName);
     }
 }
 
@@ -289,18 +323,10 @@ void AAriaCharacter::FinishEquipping()
 
 // --- PlayEquipMontage ---
 // Plays the equip/unequip montage with the specified section.
-void AAriaCharacter::PlayEquipMontage(const FName& SectionName)
+void AAriaCharacter::PlayEquipMontage(bool bEquip)
 {
-    // Get the animation instance from the character’s mesh.
-    UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-    // Check if the anim instance and equip montage are valid before proceeding.
-    if (AnimInstance && EquipMontage)
-    {
-        // Play the equip montage with default settings.
-        AnimInstance->Montage_Play(EquipMontage);
-        // Jump to the specified section in the equip montage.
-        AnimInstance->Montage_JumpToSection(SectionName, EquipMontage);
-    }
+    // Start the equip montage directly at the Equip (entry 0) or UnEquip (entry 1) section.
+    EquipSections.Play(GetMesh()->GetAnimInstance(), EquipMontage, bEquip ? 0 : 1);
 }
 
 // --- AttackEnd ---
@@ -315,6 +341,7 @@ void AAriaCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+    UpdatePickupCandidates();
 }
 
 // -- - Setup Player Input Component-- -
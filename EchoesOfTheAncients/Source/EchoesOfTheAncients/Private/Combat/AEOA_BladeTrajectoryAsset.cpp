@@ -0,0 +1,91 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_BladeTrajectoryAsset class, baking the weapon
+// socket path of a montage in the editor and sampling it at runtime.
+
+#include "Combat/AEOA_BladeTrajectoryAsset.h"
+#include "Animation/AnimMontage.h"
+#include "EchoesOfTheAncients/EchoesOfTheAncients.h"
+
+#if WITH_EDITOR
+#include "AnimPose.h"
+#include "Engine/SkeletalMesh.h"
+#endif
+
+// --- SampleSocket ---
+bool UAEOA_BladeTrajectoryAsset::SampleSocket(FName SectionName, float Position, FTransform& OutSocketTransform) const
+{
+	const FAEOA_BladeTrajectorySection* Section = Sections.FindByPredicate([SectionName](const FAEOA_BladeTrajectorySection& Candidate)
+	{
+		return Candidate.SectionName == SectionName;
+	});
+	if (!Section || Section->Locations.Num() == 0 || Section->SampleInterval <= 0.f) return false;
+
+	const float SampleTime = FMath::Clamp((Position - Section->StartTime) / Section->SampleInterval, 0.f, static_cast<float>(Section->Locations.Num() - 1));
+	const int32 Index = FMath::FloorToInt32(SampleTime);
+	const int32 NextIndex = FMath::Min(Index + 1, Section->Locations.Num() - 1);
+	const float Alpha = SampleTime - Index;
+
+	OutSocketTransform.SetLocation(FVector(FMath::Lerp(Section->Locations[Index], Section->Locations[NextIndex], Alpha)));
+	OutSocketTransform.SetRotation(FQuat(FQuat4f::Slerp(Section->Rotations[Index], Section->Rotations[NextIndex], Alpha)));
+	OutSocketTransform.SetScale3D(FVector::OneVector);
+	return true;
+}
+
+#if WITH_EDITOR
+// --- Bake ---
+// Each montage position is mapped to the sequence segment playing in the first slot track,
+// and the socket is read from that sequence's pose in component space.
+void UAEOA_BladeTrajectoryAsset::Bake()
+{
+	if (!Montage || Montage->SlotAnimTracks.Num() == 0)
+	{
+		UE_LOG(LogEchoesOfTheAncients, Warning, TEXT("%s: no montage with a slot track to bake."), *GetName());
+		return;
+	}
+
+	FAnimPoseEvaluationOptions EvaluationOptions;
+	EvaluationOptions.OptionalSkeletalMesh = BakeMesh.LoadSynchronous();
+
+	const FAnimTrack& AnimTrack = Montage->SlotAnimTracks[0].AnimTrack;
+	const float SampleInterval = 1.f / FMath::Max(SampleRate, 1.f);
+
+	Sections.Reset();
+	for (int32 SectionIndex = 0; SectionIndex < Montage->CompositeSections.Num(); ++SectionIndex)
+	{
+		float StartTime = 0.f;
+		float EndTime = 0.f;
+		Montage->GetSectionStartAndEndTime(SectionIndex, StartTime, EndTime);
+
+		FAEOA_BladeTrajectorySection& Section = Sections.AddDefaulted_GetRef();
+		Section.SectionName = Montage->CompositeSections[SectionIndex].SectionName;
+		Section.StartTime = StartTime;
+		Section.SampleInterval = SampleInterval;
+
+		const int32 NumSamples = FMath::CeilToInt32((EndTime - StartTime) / SampleInterval) + 1;
+		Section.Locations.Reserve(NumSamples);
+		Section.Rotations.Reserve(NumSamples);
+
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			const float Time = FMath::Min(StartTime + Sample * SampleInterval, EndTime);
+
+			FTransform SocketTransform = FTransform::Identity;
+			if (const FAnimSegment* Segment = AnimTrack.GetSegmentAtTime(Time))
+			{
+				if (const UAnimSequenceBase* Sequence = Segment->GetAnimReference())
+				{
+					FAnimPose Pose;
+					UAnimPoseExtensions::GetAnimPoseAtTime(Sequence, Segment->ConvertTrackPosToAnimPos(Time), EvaluationOptions, Pose);
+					SocketTransform = UAnimPoseExtensions::GetSocketPose(Pose, SocketName, EAnimPoseSpaces::World);
+				}
+			}
+
+			Section.Locations.Add(FVector3f(SocketTransform.GetLocation()));
+			Section.Rotations.Add(FQuat4f(SocketTransform.GetRotation()));
+		}
+	}
+
+	MarkPackageDirty();
+	UE_LOG(LogEchoesOfTheAncients, Log, TEXT("%s: baked %d sections of %s at %.0f Hz."), *GetName(), Sections.Num(), *Montage->GetName(), SampleRate);
+}
+#endif
@@ -0,0 +1,130 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_CombatAwarenessSubsystem class, checking the
+// distances of engaged enemy–target pairs in one batched pass.
+
+#include "Combat/AEOA_CombatAwarenessSubsystem.h"
+#include "Enemies/AEOA_Enemy.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Combat Awareness Update"), STAT_AEOA_CombatAwarenessUpdate, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Engaged Enemies"), STAT_AEOA_EngagedEnemies, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarCombatAwarenessUpdateInterval(
+	TEXT("AEOA.CombatAwareness.UpdateInterval"),
+	0.1f,
+	TEXT("Seconds between two checks of the engaged enemy-target distances. 0 checks every frame."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_CombatAwarenessSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_CombatAwarenessSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	Targets.Empty();
+	RadiiSquared.Empty();
+	InRange.Empty();
+	Transitions.Empty();
+	OnCombatRangeChanged.Clear();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_CombatAwarenessSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_CombatAwarenessSubsystem, STATGROUP_Tickables);
+}
+
+// --- Engage ---
+void UAEOA_CombatAwarenessSubsystem::Engage(AAEOA_Enemy* Enemy, AActor* Target, float Radius)
+{
+	if (!Enemy || !Target) return;
+
+	int32 Index = Enemies.Find(Enemy);
+	if (Index == INDEX_NONE)
+	{
+		Index = Enemies.Add(Enemy);
+		Targets.AddDefaulted();
+		RadiiSquared.AddDefaulted();
+		InRange.AddDefaulted();
+	}
+	Targets[Index] = Target;
+	RadiiSquared[Index] = FMath::Square(Radius);
+	InRange[Index] = true;
+}
+
+// --- Disengage ---
+void UAEOA_CombatAwarenessSubsystem::Disengage(AAEOA_Enemy* Enemy)
+{
+	const int32 Index = Enemies.Find(Enemy);
+	if (Index == INDEX_NONE) return;
+
+	Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Targets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RadiiSquared.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	InRange.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// --- Tick ---
+void UAEOA_CombatAwarenessSubsystem::Tick(float DeltaTime)
+{
+	SET_DWORD_STAT(STAT_AEOA_EngagedEnemies, Enemies.Num());
+	if (Enemies.IsEmpty()) return;
+
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate < CVarCombatAwarenessUpdateInterval.GetValueOnGameThread()) return;
+	TimeSinceUpdate = 0.f;
+
+	UpdatePairs();
+}
+
+// --- UpdatePairs ---
+// Transitions are collected first and reported after the pass, since handlers usually disengage the enemy.
+void UAEOA_CombatAwarenessSubsystem::UpdatePairs()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_CombatAwarenessUpdate);
+
+	Transitions.Reset();
+	for (int32 Index = Enemies.Num() - 1; Index >= 0; --Index)
+	{
+		AAEOA_Enemy* Enemy = Enemies[Index];
+		AActor* Target = Targets[Index];
+		if (!IsValid(Enemy) || !IsValid(Target))
+		{
+			// A destroyed target counts as leaving range, so the enemy still cleans up its combat state.
+			if (IsValid(Enemy) && InRange[Index])
+			{
+				Transitions.Emplace(Enemy, false);
+			}
+			Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			Targets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			RadiiSquared.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			InRange.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const bool bInRange = FVector::DistSquared(Enemy->GetActorLocation(), Target->GetActorLocation()) <= RadiiSquared[Index];
+		if (bInRange != InRange[Index])
+		{
+			InRange[Index] = bInRange;
+			Transitions.Emplace(Enemy, bInRange);
+		}
+	}
+
+	for (const TPair<TWeakObjectPtr<AAEOA_Enemy>, bool>& Transition : Transitions)
+	{
+		if (AAEOA_Enemy* Enemy = Transition.Key.Get())
+		{
+			AActor* Target = Enemy->GetCombatTarget();
+			Enemy->OnCombatRangeChanged(Transition.Value);
+			OnCombatRangeChanged.Broadcast(Enemy, Target, Transition.Value);
+		}
+	}
+	Transitions.Reset();
+}
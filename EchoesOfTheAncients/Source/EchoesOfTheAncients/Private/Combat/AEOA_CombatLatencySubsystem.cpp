@@ -0,0 +1,200 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_CombatLatencySubsystem class, timestamping attack
+// stages and reporting input-to-impact delays through stats, trace and log.
+
+#include "Combat/AEOA_CombatLatencySubsystem.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "EchoesOfTheAncients/EchoesOfTheAncients.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Trace/Trace.h"
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Latency Input To Montage (ms)"), STAT_AEOA_LatencyInputToMontage, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Latency Montage To Collision (ms)"), STAT_AEOA_LatencyMontageToCollision, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Latency Collision To Impact (ms)"), STAT_AEOA_LatencyCollisionToImpact, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Latency Input To Impact (ms)"), STAT_AEOA_LatencyInputToImpact, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Latency Input To Impact (frames)"), STAT_AEOA_LatencyInputToImpactFrames, STATGROUP_EchoesOfTheAncients);
+
+TRACE_DECLARE_FLOAT_COUNTER(AEOA_LatencyInputToMontage, TEXT("AEOA/Combat Latency/Input To Montage (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(AEOA_LatencyMontageToCollision, TEXT("AEOA/Combat Latency/Montage To Collision (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(AEOA_LatencyCollisionToImpact, TEXT("AEOA/Combat Latency/Collision To Impact (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(AEOA_LatencyInputToImpact, TEXT("AEOA/Combat Latency/Input To Impact (ms)"));
+
+// Stage bookmarks are only emitted when the channel is enabled, e.g., -trace=default,AEOA_CombatLatency.
+UE_TRACE_CHANNEL_DEFINE(AEOA_CombatLatencyChannel);
+
+static TAutoConsoleVariable<bool> CVarCombatLatencyEnabled(
+	TEXT("AEOA.CombatLatency.Enabled"),
+	true,
+	TEXT("Timestamp attack stages and collect input-to-impact latency histograms."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatLatencyBinMs(
+	TEXT("AEOA.CombatLatency.BinMs"),
+	5.f,
+	TEXT("Width in milliseconds of the latency histogram bins, applied on the next reset."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatLatencyMaxMs(
+	TEXT("AEOA.CombatLatency.MaxMs"),
+	600.f,
+	TEXT("Upper bound in milliseconds of the latency histograms; longer delays fall in the last bin. Applied on the next reset."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorld GDumpCombatLatencyCommand(
+	TEXT("AEOA.CombatLatency.Dump"),
+	TEXT("Logs the input-to-impact latency histograms of the current world."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UAEOA_CombatLatencySubsystem* Latency = World ? World->GetSubsystem<UAEOA_CombatLatencySubsystem>() : nullptr)
+		{
+			Latency->DumpReport();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld GResetCombatLatencyCommand(
+	TEXT("AEOA.CombatLatency.Reset"),
+	TEXT("Clears the input-to-impact latency histograms of the current world."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UAEOA_CombatLatencySubsystem* Latency = World ? World->GetSubsystem<UAEOA_CombatLatencySubsystem>() : nullptr)
+		{
+			Latency->ResetMeasurements();
+		}
+	}));
+
+static const TCHAR* StageNames[] = { TEXT("Input"), TEXT("Montage Start"), TEXT("Collision Open"), TEXT("Impact") };
+static const TCHAR* IntervalNames[] = { TEXT("Input to montage"), TEXT("Montage to collision"), TEXT("Collision to impact"), TEXT("Input to impact") };
+
+// --- DoesSupportWorldType ---
+bool UAEOA_CombatLatencySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Initialize ---
+void UAEOA_CombatLatencySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ResetMeasurements();
+}
+
+// --- Deinitialize ---
+void UAEOA_CombatLatencySubsystem::Deinitialize()
+{
+	Timelines.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- MarkStage ---
+// Only the first collision window and the first impact of an attack count, so multi-window swings
+// and hits on several victims do not skew the delays.
+void UAEOA_CombatLatencySubsystem::MarkStage(const AActor* Attacker, EAEOA_AttackStage Stage)
+{
+	if (!Attacker || Stage == EAEOA_AttackStage::MAX || !CVarCombatLatencyEnabled.GetValueOnGameThread()) return;
+
+	const int32 StageIndex = static_cast<int32>(Stage);
+	FAttackTimeline* Timeline = nullptr;
+	if (Stage == EAEOA_AttackStage::Input)
+	{
+		Timeline = &Timelines.FindOrAdd(Attacker);
+		Timeline->AttackId = NextAttackId++;
+		++NumAttacksStarted;
+	}
+	else
+	{
+		Timeline = Timelines.Find(Attacker);
+		if (!Timeline || Timeline->NextStage != StageIndex) return;
+	}
+
+	Timeline->Seconds[StageIndex] = FPlatformTime::Seconds();
+	Timeline->Frames[StageIndex] = GFrameCounter;
+	Timeline->NextStage = StageIndex + 1;
+
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(AEOA_CombatLatencyChannel))
+	{
+		TRACE_BOOKMARK(TEXT("AEOA Attack %u: %s"), Timeline->AttackId, StageNames[StageIndex]);
+	}
+
+	if (Stage == EAEOA_AttackStage::Impact)
+	{
+		RecordLandedAttack(*Timeline);
+	}
+}
+
+// --- RecordLandedAttack ---
+void UAEOA_CombatLatencySubsystem::RecordLandedAttack(const FAttackTimeline& Timeline)
+{
+	static constexpr int32 IntervalStages[NumIntervals][2] =
+	{
+		{ static_cast<int32>(EAEOA_AttackStage::Input), static_cast<int32>(EAEOA_AttackStage::MontageStart) },
+		{ static_cast<int32>(EAEOA_AttackStage::MontageStart), static_cast<int32>(EAEOA_AttackStage::CollisionOpen) },
+		{ static_cast<int32>(EAEOA_AttackStage::CollisionOpen), static_cast<int32>(EAEOA_AttackStage::Impact) },
+		{ static_cast<int32>(EAEOA_AttackStage::Input), static_cast<int32>(EAEOA_AttackStage::Impact) },
+	};
+
+	float DelaysMs[NumIntervals];
+	for (int32 Interval = 0; Interval < NumIntervals; ++Interval)
+	{
+		const int32 From = IntervalStages[Interval][0];
+		const int32 To = IntervalStages[Interval][1];
+		DelaysMs[Interval] = static_cast<float>((Timeline.Seconds[To] - Timeline.Seconds[From]) * 1000.0);
+		Histograms[Interval].AddMeasurement(DelaysMs[Interval]);
+
+		const uint64 Frames = Timeline.Frames[To] - Timeline.Frames[From];
+		FrameDelays[Interval].Total += Frames;
+		FrameDelays[Interval].Max = FMath::Max(FrameDelays[Interval].Max, Frames);
+	}
+	++NumAttacksLanded;
+
+	SET_FLOAT_STAT(STAT_AEOA_LatencyInputToMontage, DelaysMs[InputToMontage]);
+	SET_FLOAT_STAT(STAT_AEOA_LatencyMontageToCollision, DelaysMs[MontageToCollision]);
+	SET_FLOAT_STAT(STAT_AEOA_LatencyCollisionToImpact, DelaysMs[CollisionToImpact]);
+	SET_FLOAT_STAT(STAT_AEOA_LatencyInputToImpact, DelaysMs[InputToImpact]);
+	SET_DWORD_STAT(STAT_AEOA_LatencyInputToImpactFrames, static_cast<uint32>(Timeline.Frames[NumStages - 1] - Timeline.Frames[0]));
+
+	TRACE_COUNTER_SET(AEOA_LatencyInputToMontage, DelaysMs[InputToMontage]);
+	TRACE_COUNTER_SET(AEOA_LatencyMontageToCollision, DelaysMs[MontageToCollision]);
+	TRACE_COUNTER_SET(AEOA_LatencyCollisionToImpact, DelaysMs[CollisionToImpact]);
+	TRACE_COUNTER_SET(AEOA_LatencyInputToImpact, DelaysMs[InputToImpact]);
+}
+
+// --- DumpReport ---
+void UAEOA_CombatLatencySubsystem::DumpReport()
+{
+	UE_LOG(LogEchoesOfTheAncients, Log, TEXT("Combat latency: %d attacks started, %d landed"), NumAttacksStarted, NumAttacksLanded);
+	if (NumAttacksLanded == 0) return;
+
+	for (int32 Interval = 0; Interval < NumIntervals; ++Interval)
+	{
+		const FHistogram& Histogram = Histograms[Interval];
+		UE_LOG(LogEchoesOfTheAncients, Log, TEXT("  %s: avg %.2f ms, min %.2f ms, max %.2f ms, avg %.2f frames, max %llu frames"),
+			IntervalNames[Interval],
+			Histogram.GetAverageOfAllMeasurements(), Histogram.GetMinOfAllMeasurements(), Histogram.GetMaxOfAllMeasurements(),
+			static_cast<double>(FrameDelays[Interval].Total) / NumAttacksLanded, FrameDelays[Interval].Max);
+	}
+	for (int32 Interval = 0; Interval < NumIntervals; ++Interval)
+	{
+		Histograms[Interval].DumpToLog(IntervalNames[Interval]);
+	}
+}
+
+// --- ResetMeasurements ---
+// Every histogram shares the same linear bins, so intervals can be compared bin for bin.
+void UAEOA_CombatLatencySubsystem::ResetMeasurements()
+{
+	const double BinMs = FMath::Max(CVarCombatLatencyBinMs.GetValueOnGameThread(), 0.1f);
+	const double MaxMs = FMath::Max<double>(CVarCombatLatencyMaxMs.GetValueOnGameThread(), BinMs);
+	for (int32 Interval = 0; Interval < NumIntervals; ++Interval)
+	{
+		Histograms[Interval].InitLinear(0.0, MaxMs, BinMs);
+		FrameDelays[Interval] = FFrameDelays();
+	}
+	Timelines.Reset();
+	NumAttacksStarted = 0;
+	NumAttacksLanded = 0;
+}
@@ -0,0 +1,176 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_CombatResolutionSubsystem class, resolving
+// the weapon hits of a frame in one grouped, deduplicated pass.
+
+#include "Combat/AEOA_CombatResolutionSubsystem.h"
+#include "Combat/AEOA_CombatLatencySubsystem.h"
+#include "Combat/AEOA_FieldApplicationSubsystem.h"
+#include "Combat/AEOA_StatusEffectSubsystem.h"
+#include "Items/Weapons/AEOA_Weapon.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "GameFramework/Controller.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/HitInterface.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_CYCLE_STAT(TEXT("Combat Resolution"), STAT_AEOA_CombatResolution, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits Resolved"), STAT_AEOA_HitsResolved, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits Deduplicated"), STAT_AEOA_HitsDeduplicated, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Victims Resolved"), STAT_AEOA_VictimsResolved, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<bool> CVarCombatResolutionBatched(
+	TEXT("AEOA.CombatResolution.Batched"),
+	true,
+	TEXT("Resolve weapon hits once per frame, grouped by victim. 0 resolves every hit as soon as it is queued."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_CombatResolutionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_CombatResolutionSubsystem::Deinitialize()
+{
+	QueuedHits.Empty();
+	ResolvingHits.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_CombatResolutionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_CombatResolutionSubsystem, STATGROUP_Tickables);
+}
+
+// --- QueueHit ---
+void UAEOA_CombatResolutionSubsystem::QueueHit(const FAEOA_HitRecord& Record)
+{
+	if (!Record.Victim.IsValid()) return;
+
+	QueuedHits.Add(Record);
+
+	if (!CVarCombatResolutionBatched.GetValueOnGameThread())
+	{
+		ResolveHits();
+	}
+}
+
+// --- Tick ---
+void UAEOA_CombatResolutionSubsystem::Tick(float DeltaTime)
+{
+	if (QueuedHits.Num() > 0)
+	{
+		ResolveHits();
+	}
+}
+
+// --- ResolveHits ---
+// Sorting by victim makes each victim's hits contiguous; within a victim, the same weapon swing counts once.
+void UAEOA_CombatResolutionSubsystem::ResolveHits()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_CombatResolution);
+
+	Swap(QueuedHits, ResolvingHits);
+	QueuedHits.Reset();
+
+	// Stable so the hits of a victim keep the order they landed in.
+	ResolvingHits.StableSort([](const FAEOA_HitRecord& A, const FAEOA_HitRecord& B)
+	{
+		return A.Victim.Get() < B.Victim.Get();
+	});
+
+	int32 NumDeduplicated = 0;
+	int32 Write = 0;
+	for (int32 Read = 0; Read < ResolvingHits.Num(); ++Read)
+	{
+		const FAEOA_HitRecord& Hit = ResolvingHits[Read];
+		bool bDuplicate = false;
+		for (int32 Previous = Write - 1; Previous >= 0 && ResolvingHits[Previous].Victim == Hit.Victim; --Previous)
+		{
+			if (ResolvingHits[Previous].Weapon == Hit.Weapon && ResolvingHits[Previous].SwingId == Hit.SwingId)
+			{
+				bDuplicate = true;
+				break;
+			}
+		}
+		if (bDuplicate)
+		{
+			++NumDeduplicated;
+			continue;
+		}
+		if (Write != Read)
+		{
+			ResolvingHits[Write] = Hit;
+		}
+		++Write;
+	}
+	ResolvingHits.SetNum(Write, EAllowShrinking::No);
+
+	// Damage first, so every reaction sees the health left after all of this frame's hits.
+	// The latency tracker only keeps the first impact of each attack.
+	UAEOA_CombatLatencySubsystem* Latency = GetWorld()->GetSubsystem<UAEOA_CombatLatencySubsystem>();
+	for (const FAEOA_HitRecord& Hit : ResolvingHits)
+	{
+		if (AActor* Victim = Hit.Victim.Get())
+		{
+			UGameplayStatics::ApplyDamage(Victim, Hit.Damage, Hit.Attacker.Get(), Hit.Weapon.Get(), UDamageType::StaticClass());
+
+			if (Latency && Hit.Weapon.IsValid())
+			{
+				Latency->MarkStage(Hit.Weapon->GetOwner(), EAEOA_AttackStage::Impact);
+			}
+		}
+	}
+
+	// Status effects after the damage, so victims killed by the hit are not affected.
+	if (UAEOA_StatusEffectSubsystem* StatusEffects = GetWorld()->GetSubsystem<UAEOA_StatusEffectSubsystem>())
+	{
+		for (const FAEOA_HitRecord& Hit : ResolvingHits)
+		{
+			AActor* Victim = Hit.Victim.Get();
+			const AAEOA_Weapon* Weapon = Hit.Weapon.Get();
+			if (!Victim || !Weapon) continue;
+
+			for (const FAEOA_StatusEffectSpec& Effect : Weapon->HitEffects)
+			{
+				StatusEffects->ApplyEffect(Victim, Effect);
+			}
+		}
+	}
+
+	// One reaction per victim, at the first impact of the frame; the reaction plays the victim's hit sound and particles.
+	int32 NumVictims = 0;
+	for (int32 Index = 0; Index < ResolvingHits.Num(); ++Index)
+	{
+		const FAEOA_HitRecord& Hit = ResolvingHits[Index];
+		if (Index > 0 && ResolvingHits[Index - 1].Victim == Hit.Victim) continue;
+
+		AActor* Victim = Hit.Victim.Get();
+		if (IsValid(Victim) && Victim->Implements<UHitInterface>())
+		{
+			IHitInterface::Execute_GetHit(Victim, Hit.ImpactPoint);
+			++NumVictims;
+		}
+	}
+
+	// Fields last, queued once per hit and applied together, so nearby impacts share one field.
+	for (const FAEOA_HitRecord& Hit : ResolvingHits)
+	{
+		if (AAEOA_Weapon* Weapon = Hit.Weapon.Get())
+		{
+			Weapon->ApplyHitFields(Hit.ImpactPoint);
+		}
+	}
+	if (UAEOA_FieldApplicationSubsystem* FieldSubsystem = GetWorld()->GetSubsystem<UAEOA_FieldApplicationSubsystem>())
+	{
+		FieldSubsystem->ApplyQueuedFields();
+	}
+
+	INC_DWORD_STAT_BY(STAT_AEOA_HitsResolved, ResolvingHits.Num());
+	INC_DWORD_STAT_BY(STAT_AEOA_HitsDeduplicated, NumDeduplicated);
+	INC_DWORD_STAT_BY(STAT_AEOA_VictimsResolved, NumVictims);
+	ResolvingHits.Reset();
+}
@@ -0,0 +1,110 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_CombatTraceSubsystem class, queuing weapon
+// sweeps asynchronously and resolving them on the following frame.
+
+#include "Combat/AEOA_CombatTraceSubsystem.h"
+#include "Items/Weapons/AEOA_Weapon.h"
+#include "EchoesOfTheAncients/AEOA_CollisionChannels.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Combat Trace Resolve"), STAT_AEOA_CombatTraceResolve, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Traces Per Frame"), STAT_AEOA_CombatTracesPerFrame, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Combat Trace Avg Latency (ms)"), STAT_AEOA_CombatTraceLatency, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<bool> CVarCombatTraceAsync(
+	TEXT("AEOA.CombatTrace.Async"),
+	true,
+	TEXT("Run weapon sweeps through the async trace API and resolve them next frame. 0 sweeps synchronously."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_CombatTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Initialize ---
+void UAEOA_CombatTraceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UAEOA_CombatTraceSubsystem::ResolvePendingSweeps);
+}
+
+// --- Deinitialize ---
+void UAEOA_CombatTraceSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	PendingSweeps.Empty();
+	ResolvingSweeps.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- QueueWeaponSweep ---
+void UAEOA_CombatTraceSubsystem::QueueWeaponSweep(AAEOA_Weapon* Weapon, int32 SwingId, const FVector& Start, const FVector& End, const FQuat& Rotation, const FCollisionShape& Shape, const FCollisionQueryParams& QueryParams)
+{
+	UWorld* World = GetWorld();
+	if (!World || !Weapon) return;
+
+	++NumSweepsThisFrame;
+
+	// Object queries report every hurtbox shape the sweep passes through, and nothing else.
+	const FCollisionObjectQueryParams ObjectParams(ECC_AEOA_Hurtbox);
+
+	if (!CVarCombatTraceAsync.GetValueOnGameThread())
+	{
+		SyncHits.Reset();
+		World->SweepMultiByObjectType(SyncHits, Start, End, Rotation, ObjectParams, Shape, QueryParams);
+		Weapon->ReceiveSweepHits(SwingId, SyncHits);
+		return;
+	}
+
+	FPendingSweep& Pending = PendingSweeps.AddDefaulted_GetRef();
+	Pending.Handle = World->AsyncSweepByObjectType(EAsyncTraceType::Multi, Start, End, Rotation, ObjectParams, Shape, QueryParams);
+	Pending.Weapon = Weapon;
+	Pending.SwingId = SwingId;
+	Pending.RequestTime = FPlatformTime::Seconds();
+}
+
+// --- ResolvePendingSweeps ---
+// Async traces requested during a frame complete before the next one starts ticking actors,
+// so every weapon sees the hits of its previous frame before it sweeps again.
+void UAEOA_CombatTraceSubsystem::ResolvePendingSweeps(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld()) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_CombatTraceResolve);
+
+	SET_DWORD_STAT(STAT_AEOA_CombatTracesPerFrame, NumSweepsThisFrame);
+	NumSweepsThisFrame = 0;
+
+	Swap(PendingSweeps, ResolvingSweeps);
+	PendingSweeps.Reset();
+
+	const double Now = FPlatformTime::Seconds();
+	double TotalLatency = 0.0;
+	int32 NumResolved = 0;
+
+	FTraceDatum TraceDatum;
+	for (const FPendingSweep& Pending : ResolvingSweeps)
+	{
+		if (!World->QueryTraceData(Pending.Handle, TraceDatum)) continue;
+
+		TotalLatency += Now - Pending.RequestTime;
+		++NumResolved;
+
+		if (AAEOA_Weapon* Weapon = Pending.Weapon.Get())
+		{
+			Weapon->ReceiveSweepHits(Pending.SwingId, TraceDatum.OutHits);
+		}
+	}
+	ResolvingSweeps.Reset();
+
+	if (NumResolved > 0)
+	{
+		SET_FLOAT_STAT(STAT_AEOA_CombatTraceLatency, static_cast<float>(TotalLatency / NumResolved * 1000.0));
+	}
+}
@@ -0,0 +1,165 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_FieldApplicationSubsystem class, merging the
+// weapon impacts of a frame into pooled, natively applied fields.
+
+#include "Combat/AEOA_FieldApplicationSubsystem.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "Engine/World.h"
+#include "Field/FieldSystemComponent.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Field Application"), STAT_AEOA_FieldApplication, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Field Impacts Queued"), STAT_AEOA_FieldImpactsQueued, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fields Applied"), STAT_AEOA_FieldsApplied, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fields Skipped (No Geometry)"), STAT_AEOA_FieldsSkipped, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<bool> CVarFieldsNative(
+	TEXT("AEOA.Fields.Native"),
+	true,
+	TEXT("Apply weapon impact fields natively through pooled field system components. 0 falls back to the weapon's CreateFields Blueprint event."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFieldsMergeDistance(
+	TEXT("AEOA.Fields.MergeDistance"),
+	100.f,
+	TEXT("Impacts of the same frame closer than this distance are merged into one field, in Unreal units."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFieldsPoolSize(
+	TEXT("AEOA.Fields.PoolSize"),
+	4,
+	TEXT("Number of pooled field system components, reused round-robin by the impacts of a frame."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_FieldApplicationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_FieldApplicationSubsystem::Deinitialize()
+{
+	QueuedImpacts.Empty();
+	FieldComponents.Empty();
+	PoolOwner = nullptr;
+
+	Super::Deinitialize();
+}
+
+// --- QueueImpact ---
+// Impacts are merged as they are queued: an impact close to a queued one grows it instead of adding a field.
+bool UAEOA_FieldApplicationSubsystem::QueueImpact(const FVector& Location, float Radius, float Strain, float Impulse)
+{
+	if (!CVarFieldsNative.GetValueOnGameThread()) return false;
+
+	INC_DWORD_STAT(STAT_AEOA_FieldImpactsQueued);
+
+	const float MergeDistanceSquared = FMath::Square(CVarFieldsMergeDistance.GetValueOnGameThread());
+	for (FFieldImpact& Impact : QueuedImpacts)
+	{
+		if (FVector::DistSquared(Impact.Location, Location) > MergeDistanceSquared) continue;
+
+		// The merged field is centered on the average impact and grown to still cover every merged one.
+		const FVector MergedLocation = (Impact.Location * Impact.NumMerged + Location) / (Impact.NumMerged + 1);
+		Impact.Radius = FMath::Max(Impact.Radius + FVector::Dist(Impact.Location, MergedLocation), Radius + FVector::Dist(Location, MergedLocation));
+		Impact.Location = MergedLocation;
+		Impact.Strain = FMath::Max(Impact.Strain, Strain);
+		Impact.Impulse = FMath::Max(Impact.Impulse, Impulse);
+		++Impact.NumMerged;
+		return true;
+	}
+
+	FFieldImpact& Impact = QueuedImpacts.AddDefaulted_GetRef();
+	Impact.Location = Location;
+	Impact.Radius = Radius;
+	Impact.Strain = Strain;
+	Impact.Impulse = Impulse;
+	return true;
+}
+
+// --- ApplyQueuedFields ---
+void UAEOA_FieldApplicationSubsystem::ApplyQueuedFields()
+{
+	if (QueuedImpacts.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_FieldApplication);
+
+	int32 NumApplied = 0;
+	int32 NumSkipped = 0;
+	for (const FFieldImpact& Impact : QueuedImpacts)
+	{
+		// Most hits land on enemies, far from any breakable: skip them before building a field command.
+		if (!HasGeometryCollectionInRange(Impact.Location, Impact.Radius))
+		{
+			++NumSkipped;
+			continue;
+		}
+
+		// Field commands are applied immediately, so a component can serve several impacts of the same frame.
+		EnsurePool();
+		UFieldSystemComponent* FieldComponent = FieldComponents[NextComponent];
+		NextComponent = (NextComponent + 1) % FieldComponents.Num();
+
+		FieldComponent->ApplyStrainField(true, Impact.Location, Impact.Radius, Impact.Strain, 1);
+		FieldComponent->ApplyRadialVectorFalloffForce(true, Impact.Location, Impact.Radius, Impact.Impulse);
+		++NumApplied;
+	}
+	QueuedImpacts.Reset();
+
+	INC_DWORD_STAT_BY(STAT_AEOA_FieldsApplied, NumApplied);
+	INC_DWORD_STAT_BY(STAT_AEOA_FieldsSkipped, NumSkipped);
+}
+
+// --- HasGeometryCollectionInRange ---
+bool UAEOA_FieldApplicationSubsystem::HasGeometryCollectionInRange(const FVector& Location, float Radius) const
+{
+	UWorld* World = GetWorld();
+	if (!World) return false;
+
+	// Geometry collections use the Destructible object type by default; some are placed as WorldDynamic.
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECollisionChannel::ECC_Destructible);
+	ObjectParams.AddObjectTypesToQuery(ECollisionChannel::ECC_WorldDynamic);
+
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByObjectType(Overlaps, Location, FQuat::Identity, ObjectParams, FCollisionShape::MakeSphere(Radius));
+
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		if (Cast<UGeometryCollectionComponent>(Overlap.GetComponent()))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// --- EnsurePool ---
+// Fields are positioned by their nodes, so the pooled components only need to be registered, not placed.
+void UAEOA_FieldApplicationSubsystem::EnsurePool()
+{
+	const int32 PoolSize = FMath::Max(1, CVarFieldsPoolSize.GetValueOnGameThread());
+	if (FieldComponents.Num() == PoolSize) return;
+
+	UWorld* World = GetWorld();
+	if (!PoolOwner)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		PoolOwner = World->SpawnActor<AActor>(SpawnParams);
+	}
+
+	while (FieldComponents.Num() < PoolSize)
+	{
+		UFieldSystemComponent* FieldComponent = NewObject<UFieldSystemComponent>(PoolOwner);
+		FieldComponent->RegisterComponent();
+		FieldComponents.Add(FieldComponent);
+	}
+	while (FieldComponents.Num() > PoolSize)
+	{
+		FieldComponents.Pop()->DestroyComponent();
+	}
+	NextComponent = 0;
+}
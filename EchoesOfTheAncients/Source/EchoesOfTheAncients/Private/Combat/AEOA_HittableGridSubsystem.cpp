@@ -0,0 +1,236 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_HittableGridSubsystem class, hashing hittable
+// actors into grid cells and answering area-of-effect queries.
+
+#include "Combat/AEOA_HittableGridSubsystem.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hittable Grid Query"), STAT_AEOA_HittableGridQuery, STATGROUP_EchoesOfTheAncients);
+DECLARE_CYCLE_STAT(TEXT("Hittable Grid Update"), STAT_AEOA_HittableGridUpdate, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Hittables In Grid"), STAT_AEOA_HittablesInGrid, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarHittableGridCellSize(
+	TEXT("AEOA.HittableGrid.CellSize"),
+	400.f,
+	TEXT("Edge length of a hittable grid cell in Unreal units. Read when a world is created."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_HittableGridSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Initialize ---
+void UAEOA_HittableGridSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(1.f, CVarHittableGridCellSize.GetValueOnGameThread());
+}
+
+// --- Deinitialize ---
+void UAEOA_HittableGridSubsystem::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_AEOA_HittablesInGrid, Actors.Num());
+	Actors.Empty();
+	Locations.Empty();
+	Radii.Empty();
+	CellKeys.Empty();
+	Movable.Empty();
+	IndexByActor.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_HittableGridSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_HittableGridSubsystem, STATGROUP_Tickables);
+}
+
+// --- GetCellKey ---
+FIntPoint UAEOA_HittableGridSubsystem::GetCellKey(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+// --- RegisterHittable ---
+void UAEOA_HittableGridSubsystem::RegisterHittable(AActor* Actor, bool bMovable)
+{
+	if (!Actor || IndexByActor.Contains(Actor)) return;
+
+	float CollisionRadius = 0.f;
+	float CollisionHalfHeight = 0.f;
+	Actor->GetSimpleCollisionCylinder(CollisionRadius, CollisionHalfHeight);
+	const float Radius = FMath::Max(CollisionRadius, CollisionHalfHeight);
+
+	const FVector Location = Actor->GetActorLocation();
+	const FIntPoint CellKey = GetCellKey(Location);
+
+	const int32 Index = Actors.Add(Actor);
+	Locations.Add(Location);
+	Radii.Add(Radius);
+	CellKeys.Add(CellKey);
+	Movable.Add(bMovable);
+	Cells.FindOrAdd(CellKey).Add(Index);
+	IndexByActor.Add(Actor, Index);
+
+	MaxRadius = FMath::Max(MaxRadius, Radius);
+	INC_DWORD_STAT(STAT_AEOA_HittablesInGrid);
+}
+
+// --- UnregisterHittable ---
+// Removes the actor with a swap, then renames the moved actor's slot inside its cell.
+void UAEOA_HittableGridSubsystem::UnregisterHittable(AActor* Actor)
+{
+	int32 Index = INDEX_NONE;
+	if (!Actor || !IndexByActor.RemoveAndCopyValue(Actor, Index)) return;
+
+	const int32 LastIndex = Actors.Num() - 1;
+
+	if (TArray<int32, TInlineAllocator<8>>* Cell = Cells.Find(CellKeys[Index]))
+	{
+		Cell->RemoveSingleSwap(Index, EAllowShrinking::No);
+		if (Cell->IsEmpty())
+		{
+			Cells.Remove(CellKeys[Index]);
+		}
+	}
+	if (Index != LastIndex)
+	{
+		if (TArray<int32, TInlineAllocator<8>>* LastCell = Cells.Find(CellKeys[LastIndex]))
+		{
+			const int32 Slot = LastCell->Find(LastIndex);
+			if (Slot != INDEX_NONE)
+			{
+				(*LastCell)[Slot] = Index;
+			}
+		}
+		IndexByActor.Add(Actors[LastIndex], Index);
+	}
+
+	Actors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	CellKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Movable.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	DEC_DWORD_STAT(STAT_AEOA_HittablesInGrid);
+}
+
+// --- MoveToCell ---
+void UAEOA_HittableGridSubsystem::MoveToCell(int32 Index, const FIntPoint& CellKey)
+{
+	if (TArray<int32, TInlineAllocator<8>>* Cell = Cells.Find(CellKeys[Index]))
+	{
+		Cell->RemoveSingleSwap(Index, EAllowShrinking::No);
+		if (Cell->IsEmpty())
+		{
+			Cells.Remove(CellKeys[Index]);
+		}
+	}
+	Cells.FindOrAdd(CellKey).Add(Index);
+	CellKeys[Index] = CellKey;
+}
+
+// --- Tick ---
+// Locations of movable actors are refreshed every frame; their cell only changes when they cross a cell edge.
+void UAEOA_HittableGridSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_HittableGridUpdate);
+
+	for (int32 Index = 0; Index < Actors.Num(); ++Index)
+	{
+		if (!Movable[Index] || !Actors[Index]) continue;
+
+		Locations[Index] = Actors[Index]->GetActorLocation();
+		const FIntPoint CellKey = GetCellKey(Locations[Index]);
+		if (CellKey != CellKeys[Index])
+		{
+			MoveToCell(Index, CellKey);
+		}
+	}
+}
+
+// --- GatherInBounds ---
+// The bounds are widened by the largest bounding radius, so an actor hashed by its center is never missed.
+template <typename TestType>
+void UAEOA_HittableGridSubsystem::GatherInBounds(const FVector& BoundsMin, const FVector& BoundsMax, TArray<AActor*>& OutActors, TestType&& Test) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_HittableGridQuery);
+
+	OutActors.Reset();
+	if (Actors.IsEmpty()) return;
+
+	const FIntPoint MinCell = GetCellKey(BoundsMin - FVector(MaxRadius, MaxRadius, 0.f));
+	const FIntPoint MaxCell = GetCellKey(BoundsMax + FVector(MaxRadius, MaxRadius, 0.f));
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<int32, TInlineAllocator<8>>* Cell = Cells.Find(FIntPoint(CellX, CellY));
+			if (!Cell) continue;
+
+			for (const int32 Index : *Cell)
+			{
+				if (Actors[Index] && Test(Locations[Index], Radii[Index]))
+				{
+					OutActors.Add(Actors[Index]);
+				}
+			}
+		}
+	}
+}
+
+// --- QuerySphere ---
+void UAEOA_HittableGridSubsystem::QuerySphere(const FVector& Center, float Radius, TArray<AActor*>& OutActors) const
+{
+	const FVector Extent(Radius);
+	GatherInBounds(Center - Extent, Center + Extent, OutActors, [&Center, Radius](const FVector& Location, float EntryRadius)
+	{
+		return FVector::DistSquared(Center, Location) <= FMath::Square(Radius + EntryRadius);
+	});
+}
+
+// --- QueryCone ---
+// A bounding sphere is inside the cone if its center is within the cone widened by the sphere radius
+// measured perpendicular to the cone's surface.
+void UAEOA_HittableGridSubsystem::QueryCone(const FVector& Origin, const FVector& Direction, float Length, float HalfAngleDegrees, TArray<AActor*>& OutActors) const
+{
+	const FVector Axis = Direction.GetSafeNormal();
+	const float HalfAngle = FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.f, 89.f));
+	const float TanHalfAngle = FMath::Tan(HalfAngle);
+	const float InvCosHalfAngle = 1.f / FMath::Cos(HalfAngle);
+
+	const FVector Tip = Origin + Axis * Length;
+	const FVector Extent(Length * TanHalfAngle);
+	const FVector BoundsMin = Origin.ComponentMin(Tip - Extent);
+	const FVector BoundsMax = Origin.ComponentMax(Tip + Extent);
+
+	GatherInBounds(BoundsMin, BoundsMax, OutActors, [&Origin, &Axis, Length, TanHalfAngle, InvCosHalfAngle](const FVector& Location, float EntryRadius)
+	{
+		const FVector ToEntry = Location - Origin;
+		const float AlongAxis = FVector::DotProduct(ToEntry, Axis);
+		if (AlongAxis < -EntryRadius || AlongAxis > Length + EntryRadius) return false;
+
+		const float FromAxis = (ToEntry - Axis * AlongAxis).Size();
+		return FromAxis <= FMath::Max(0.f, AlongAxis) * TanHalfAngle + EntryRadius * InvCosHalfAngle;
+	});
+}
+
+// --- QueryBox ---
+void UAEOA_HittableGridSubsystem::QueryBox(const FVector& Center, const FVector& Extent, const FQuat& Rotation, TArray<AActor*>& OutActors) const
+{
+	const FBox Bounds = FBox(-Extent, Extent).TransformBy(FTransform(Rotation, Center));
+
+	GatherInBounds(Bounds.Min, Bounds.Max, OutActors, [&Center, &Extent, &Rotation](const FVector& Location, float EntryRadius)
+	{
+		const FVector Local = Rotation.UnrotateVector(Location - Center);
+		const FVector Closest = Local.BoundToBox(-Extent, Extent);
+		return FVector::DistSquared(Local, Closest) <= FMath::Square(EntryRadius);
+	});
+}
@@ -0,0 +1,231 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_StatusEffectSubsystem class, stepping every
+// active status effect in one fixed-rate pass.
+
+#include "Combat/AEOA_StatusEffectSubsystem.h"
+#include "Components/AEOA_AttributeComponent.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Status Effect Step"), STAT_AEOA_StatusEffectStep, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Status Effects Active"), STAT_AEOA_StatusEffectsActive, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Status Effects Bleed"), STAT_AEOA_StatusEffectsBleed, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Status Effects Burn"), STAT_AEOA_StatusEffectsBurn, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Status Effects Slow"), STAT_AEOA_StatusEffectsSlow, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarStatusEffectsTickRate(
+	TEXT("AEOA.StatusEffects.TickRate"),
+	10.f,
+	TEXT("Steps per second of the status effect pass; damage over time is applied once per step."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarStatusEffectsMaxStepsPerFrame(
+	TEXT("AEOA.StatusEffects.MaxStepsPerFrame"),
+	4,
+	TEXT("Maximum number of steps run in one frame after a hitch; the remaining time is dropped."),
+	ECVF_Default);
+
+static constexpr int32 NumEffectTypes = static_cast<int32>(EAEOA_StatusEffectType::ESE_MAX);
+
+// --- FEffectBucket::RemoveAtSwap ---
+void UAEOA_StatusEffectSubsystem::FEffectBucket::RemoveAtSwap(int32 Index)
+{
+	Targets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StoreHandles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Magnitudes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RemainingTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Movements.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	BaseWalkSpeeds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// --- DoesSupportWorldType ---
+bool UAEOA_StatusEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_StatusEffectSubsystem::Deinitialize()
+{
+	for (FEffectBucket& Bucket : Buckets)
+	{
+		for (int32 Index = 0; Index < Bucket.Num(); ++Index)
+		{
+			RestoreWalkSpeed(Bucket, Index);
+		}
+		Bucket = FEffectBucket();
+	}
+	DamageScratch.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_StatusEffectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_StatusEffectSubsystem, STATGROUP_Tickables);
+}
+
+// --- GetNumActiveEffects ---
+int32 UAEOA_StatusEffectSubsystem::GetNumActiveEffects() const
+{
+	int32 NumEffects = 0;
+	for (const FEffectBucket& Bucket : Buckets)
+	{
+		NumEffects += Bucket.Num();
+	}
+	return NumEffects;
+}
+
+// --- ApplyEffect ---
+// Bleeds stack; burns and slows refresh the effect already on the target, so a target has at most one of each.
+void UAEOA_StatusEffectSubsystem::ApplyEffect(AActor* Target, const FAEOA_StatusEffectSpec& Spec)
+{
+	if (!Target || Spec.Duration <= 0.f || Spec.Magnitude <= 0.f || Spec.Type == EAEOA_StatusEffectType::ESE_MAX) return;
+
+	UAEOA_AttributeComponent* Attributes = Target->FindComponentByClass<UAEOA_AttributeComponent>();
+	if (!Attributes || !Attributes->IsAlive()) return;
+
+	UCharacterMovementComponent* Movement = nullptr;
+	if (Spec.Type == EAEOA_StatusEffectType::ESE_Slow)
+	{
+		Movement = Target->FindComponentByClass<UCharacterMovementComponent>();
+		if (!Movement) return;
+	}
+
+	FEffectBucket& Bucket = Buckets[static_cast<int32>(Spec.Type)];
+	if (Spec.Type != EAEOA_StatusEffectType::ESE_Bleed)
+	{
+		const int32 Existing = Bucket.Targets.IndexOfByKey(Attributes);
+		if (Existing != INDEX_NONE)
+		{
+			Bucket.RemainingTimes[Existing] = FMath::Max(Bucket.RemainingTimes[Existing], Spec.Duration);
+			Bucket.Magnitudes[Existing] = FMath::Max(Bucket.Magnitudes[Existing], Spec.Magnitude);
+			if (Movement)
+			{
+				Movement->MaxWalkSpeed = Bucket.BaseWalkSpeeds[Existing] * (1.f - FMath::Min(Bucket.Magnitudes[Existing], 1.f));
+			}
+			return;
+		}
+	}
+
+	Bucket.Targets.Add(Attributes);
+	Bucket.StoreHandles.Add(Attributes->GetStoreHandle());
+	Bucket.Magnitudes.Add(Spec.Magnitude);
+	Bucket.RemainingTimes.Add(Spec.Duration);
+	Bucket.Movements.Add(Movement);
+	Bucket.BaseWalkSpeeds.Add(Movement ? Movement->MaxWalkSpeed : 0.f);
+
+	if (Movement)
+	{
+		Movement->MaxWalkSpeed *= 1.f - FMath::Min(Spec.Magnitude, 1.f);
+	}
+}
+
+// --- ClearEffects ---
+void UAEOA_StatusEffectSubsystem::ClearEffects(AActor* Target)
+{
+	if (!Target) return;
+
+	const UAEOA_AttributeComponent* Attributes = Target->FindComponentByClass<UAEOA_AttributeComponent>();
+	if (!Attributes) return;
+
+	for (FEffectBucket& Bucket : Buckets)
+	{
+		for (int32 Index = Bucket.Num() - 1; Index >= 0; --Index)
+		{
+			if (Bucket.Targets[Index] == Attributes)
+			{
+				RestoreWalkSpeed(Bucket, Index);
+				Bucket.RemoveAtSwap(Index);
+			}
+		}
+	}
+}
+
+// --- RestoreWalkSpeed ---
+void UAEOA_StatusEffectSubsystem::RestoreWalkSpeed(FEffectBucket& Bucket, int32 Index)
+{
+	if (UCharacterMovementComponent* Movement = Bucket.Movements[Index].Get())
+	{
+		Movement->MaxWalkSpeed = Bucket.BaseWalkSpeeds[Index];
+	}
+}
+
+// --- Tick ---
+// Fixed steps keep damage over time independent of the frame rate; a hitch runs a bounded number of catch-up steps.
+void UAEOA_StatusEffectSubsystem::Tick(float DeltaTime)
+{
+	const float StepTime = 1.f / FMath::Max(CVarStatusEffectsTickRate.GetValueOnGameThread(), 1.f);
+	const int32 MaxSteps = FMath::Max(1, CVarStatusEffectsMaxStepsPerFrame.GetValueOnGameThread());
+
+	StepAccumulator += DeltaTime;
+	int32 NumSteps = 0;
+	while (StepAccumulator >= StepTime && NumSteps < MaxSteps)
+	{
+		StepAccumulator -= StepTime;
+		StepEffects(StepTime);
+		++NumSteps;
+	}
+	if (NumSteps == MaxSteps)
+	{
+		StepAccumulator = FMath::Min(StepAccumulator, StepTime);
+	}
+
+	SET_DWORD_STAT(STAT_AEOA_StatusEffectsActive, GetNumActiveEffects());
+	SET_DWORD_STAT(STAT_AEOA_StatusEffectsBleed, Buckets[static_cast<int32>(EAEOA_StatusEffectType::ESE_Bleed)].Num());
+	SET_DWORD_STAT(STAT_AEOA_StatusEffectsBurn, Buckets[static_cast<int32>(EAEOA_StatusEffectType::ESE_Burn)].Num());
+	SET_DWORD_STAT(STAT_AEOA_StatusEffectsSlow, Buckets[static_cast<int32>(EAEOA_StatusEffectType::ESE_Slow)].Num());
+}
+
+// --- StepEffects ---
+// Damage of every bleed and burn is gathered first and applied in one bulk pass,
+// so each target's health changes, and notifies its listeners, at most once per step.
+void UAEOA_StatusEffectSubsystem::StepEffects(float StepTime)
+{
+	if (GetNumActiveEffects() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_StatusEffectStep);
+
+	DamageScratch.Reset();
+	for (int32 TypeIndex = 0; TypeIndex < NumEffectTypes; ++TypeIndex)
+	{
+		FEffectBucket& Bucket = Buckets[TypeIndex];
+		const bool bDealsDamage = TypeIndex != static_cast<int32>(EAEOA_StatusEffectType::ESE_Slow);
+
+		for (int32 Index = Bucket.Num() - 1; Index >= 0; --Index)
+		{
+			const UAEOA_AttributeComponent* Target = Bucket.Targets[Index].Get();
+			if (!Target || Target->GetStoreHandle() != Bucket.StoreHandles[Index])
+			{
+				RestoreWalkSpeed(Bucket, Index);
+				Bucket.RemoveAtSwap(Index);
+				continue;
+			}
+
+			// The last step of an effect only covers the time it had left.
+			const float EffectStepTime = FMath::Min(StepTime, Bucket.RemainingTimes[Index]);
+			if (bDealsDamage)
+			{
+				DamageScratch.Add({ Bucket.StoreHandles[Index], Bucket.Magnitudes[Index] * EffectStepTime });
+			}
+
+			Bucket.RemainingTimes[Index] -= StepTime;
+			if (Bucket.RemainingTimes[Index] <= 0.f)
+			{
+				RestoreWalkSpeed(Bucket, Index);
+				Bucket.RemoveAtSwap(Index);
+			}
+		}
+	}
+
+	if (DamageScratch.Num() > 0)
+	{
+		if (UAEOA_AttributeStoreSubsystem* Store = GetWorld()->GetSubsystem<UAEOA_AttributeStoreSubsystem>())
+		{
+			Store->ApplyBulkDamage(DamageScratch);
+		}
+	}
+}
@@ -0,0 +1,31 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the FAEOA_SwingHitRegistry struct, tracking the actors hit by each weapon swing.
+
+#include "Combat/AEOA_SwingHitRegistry.h"
+
+// --- Constructor ---
+FAEOA_SwingHitRegistry::FAEOA_SwingHitRegistry()
+	: QueryParams(SCENE_QUERY_STAT(AEOA_WeaponSweep), false)
+{
+}
+
+// --- BeginSwing ---
+// Reset keeps the allocations, so a swing through a crowd reuses the memory of the previous one.
+void FAEOA_SwingHitRegistry::BeginSwing(const AActor* Weapon, const AActor* Wielder)
+{
+	++SwingId;
+	HitActors.Reset();
+
+	QueryParams.ClearIgnoredActors();
+	QueryParams.AddIgnoredActor(Weapon);
+	QueryParams.AddIgnoredActor(Wielder);
+}
+
+// --- RegisterHit ---
+bool FAEOA_SwingHitRegistry::RegisterHit(const AActor* Actor)
+{
+	if (!Actor || HitActors.Contains(Actor)) return false;
+
+	HitActors.Add(Actor);
+	return true;
+}
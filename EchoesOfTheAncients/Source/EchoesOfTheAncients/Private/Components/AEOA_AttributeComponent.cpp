@@ -3,15 +3,14 @@
 // managing actor attributes like health in Echoes of the Ancients.
 
 #include "Components/AEOA_AttributeComponent.h"
+#include "Engine/World.h"
 
 // Sets default values for this component's properties
 UAEOA_AttributeComponent::UAEOA_AttributeComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
-	// ...
+	// Attributes only change through damage, healing and the attribute store's regeneration pass,
+	// so the component never ticks.
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 
@@ -20,31 +19,94 @@ void UAEOA_AttributeComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// ...
-	
+	Store = GetWorld()->GetSubsystem<UAEOA_AttributeStoreSubsystem>();
+	if (Store)
+	{
+		StoreHandle = Store->AddEntry(this);
+		Store->InitializeAttribute(StoreHandle, EAEOA_Attribute::EA_Health, Health, MaxHealth, HealthRegenRate);
+		Store->InitializeAttribute(StoreHandle, EAEOA_Attribute::EA_Stamina, Stamina, MaxStamina, StaminaRegenRate);
+	}
 }
 
+// Called when the component is removed from play
+void UAEOA_AttributeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (Store)
+	{
+		Store->RemoveEntry(StoreHandle);
+		Store = nullptr;
+		StoreHandle = INDEX_NONE;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
 
-// Called every frame
-void UAEOA_AttributeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+float UAEOA_AttributeComponent::GetAttributeValue(EAEOA_Attribute Attribute) const
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (Store)
+	{
+		return Store->GetValue(StoreHandle, Attribute);
+	}
+	return Attribute == EAEOA_Attribute::EA_Health ? Health : Stamina;
+}
 
-	// ...
+float UAEOA_AttributeComponent::GetAttributeMaxValue(EAEOA_Attribute Attribute) const
+{
+	if (Store)
+	{
+		return Store->GetMaxValue(StoreHandle, Attribute);
+	}
+	return Attribute == EAEOA_Attribute::EA_Health ? MaxHealth : MaxStamina;
 }
 
-bool UAEOA_AttributeComponent::IsAlive()
+void UAEOA_AttributeComponent::HandleAttributeChanged(EAEOA_Attribute Attribute, float OldValue, float NewValue)
 {
-	return Health > 0.f;
+	switch (Attribute)
+	{
+	case EAEOA_Attribute::EA_Health:
+		OnHealthChanged.Broadcast(this, OldValue, NewValue);
+		break;
+	case EAEOA_Attribute::EA_Stamina:
+		OnStaminaChanged.Broadcast(this, OldValue, NewValue);
+		break;
+	default:
+		break;
+	}
+}
+
+bool UAEOA_AttributeComponent::IsAlive() const
+{
+	return GetHealth() > 0.f;
 }
 
 void UAEOA_AttributeComponent::ReceiveDamage(float Damage)
 {
-	Health = FMath::Clamp(Health - Damage, 0.f, MaxHealth);
+	SetHealth(GetHealth() - Damage);
 }
 
-float UAEOA_AttributeComponent::GetHealthPercent()
+void UAEOA_AttributeComponent::ResetHealth()
 {
-	return Health / MaxHealth;
+	SetHealth(GetMaxHealth());
 }
 
+void UAEOA_AttributeComponent::SetHealth(float NewHealth)
+{
+	if (Store)
+	{
+		Store->SetValue(StoreHandle, EAEOA_Attribute::EA_Health, NewHealth);
+		return;
+	}
+
+	const float OldHealth = Health;
+	Health = FMath::Clamp(NewHealth, 0.f, MaxHealth);
+	if (Health != OldHealth)
+	{
+		OnHealthChanged.Broadcast(this, OldHealth, Health);
+	}
+}
+
+float UAEOA_AttributeComponent::GetHealthPercent() const
+{
+	const float CurrentMaxHealth = GetMaxHealth();
+	return CurrentMaxHealth > 0.f ? GetHealth() / CurrentMaxHealth : 0.f;
+}
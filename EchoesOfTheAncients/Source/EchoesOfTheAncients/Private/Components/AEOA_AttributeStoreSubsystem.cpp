@@ -0,0 +1,233 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_AttributeStoreSubsystem class, updating attribute
+// arrays in parallel and notifying only the components that changed.
+
+#include "Components/AEOA_AttributeStoreSubsystem.h"
+#include "Components/AEOA_AttributeComponent.h"
+#include "Async/ParallelFor.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Attribute Pass"), STAT_AEOA_AttributePass, STATGROUP_EchoesOfTheAncients);
+DECLARE_CYCLE_STAT(TEXT("Attribute Dispatch"), STAT_AEOA_AttributeDispatch, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attribute Entries"), STAT_AEOA_AttributeEntries, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attribute Changes Per Pass"), STAT_AEOA_AttributeChanges, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarAttributesUpdateInterval(
+	TEXT("AEOA.Attributes.UpdateInterval"),
+	0.1f,
+	TEXT("Seconds between two regeneration passes over the attribute store."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAttributesMinParallelEntries(
+	TEXT("AEOA.Attributes.MinParallelEntries"),
+	256,
+	TEXT("Attribute passes over fewer entries than this run on the game thread, where spreading them over workers costs more than it saves."),
+	ECVF_Default);
+
+static constexpr int32 NumAttributes = static_cast<int32>(EAEOA_Attribute::EA_MAX);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_AttributeStoreSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_AttributeStoreSubsystem::Deinitialize()
+{
+	Components.Empty();
+	for (FAttributeColumn& Column : Columns)
+	{
+		Column = FAttributeColumn();
+	}
+	PendingDamage.Empty();
+	ChangedMasks.Empty();
+	FreeHandles.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_AttributeStoreSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_AttributeStoreSubsystem, STATGROUP_Tickables);
+}
+
+// --- AddEntry ---
+int32 UAEOA_AttributeStoreSubsystem::AddEntry(UAEOA_AttributeComponent* Component)
+{
+	int32 Handle;
+	if (FreeHandles.Num() > 0)
+	{
+		Handle = FreeHandles.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Handle = Components.AddDefaulted();
+		for (FAttributeColumn& Column : Columns)
+		{
+			Column.Values.AddZeroed();
+			Column.MaxValues.AddZeroed();
+			Column.RegenRates.AddZeroed();
+			Column.PreviousValues.AddZeroed();
+		}
+		PendingDamage.AddZeroed();
+		ChangedMasks.AddZeroed();
+	}
+
+	Components[Handle] = Component;
+	for (FAttributeColumn& Column : Columns)
+	{
+		Column.Values[Handle] = 0.f;
+		Column.MaxValues[Handle] = 0.f;
+		Column.RegenRates[Handle] = 0.f;
+	}
+	PendingDamage[Handle] = 0.f;
+	ChangedMasks[Handle] = 0;
+	return Handle;
+}
+
+// --- RemoveEntry ---
+void UAEOA_AttributeStoreSubsystem::RemoveEntry(int32 Handle)
+{
+	if (!Components.IsValidIndex(Handle) || !Components[Handle]) return;
+
+	Components[Handle] = nullptr;
+	ChangedMasks[Handle] = 0;
+	FreeHandles.Add(Handle);
+}
+
+// --- InitializeAttribute ---
+void UAEOA_AttributeStoreSubsystem::InitializeAttribute(int32 Handle, EAEOA_Attribute Attribute, float Value, float MaxValue, float RegenRate)
+{
+	if (!Components.IsValidIndex(Handle)) return;
+
+	FAttributeColumn& Column = Columns[static_cast<int32>(Attribute)];
+	Column.MaxValues[Handle] = MaxValue;
+	Column.Values[Handle] = FMath::Clamp(Value, 0.f, MaxValue);
+	Column.RegenRates[Handle] = RegenRate;
+}
+
+// --- SetValue ---
+void UAEOA_AttributeStoreSubsystem::SetValue(int32 Handle, EAEOA_Attribute Attribute, float NewValue)
+{
+	if (!Components.IsValidIndex(Handle) || !Components[Handle]) return;
+
+	FAttributeColumn& Column = Columns[static_cast<int32>(Attribute)];
+	const float OldValue = Column.Values[Handle];
+	const float ClampedValue = FMath::Clamp(NewValue, 0.f, Column.MaxValues[Handle]);
+	if (ClampedValue == OldValue) return;
+
+	Column.Values[Handle] = ClampedValue;
+	Components[Handle]->HandleAttributeChanged(Attribute, OldValue, ClampedValue);
+}
+
+// --- GetValue ---
+float UAEOA_AttributeStoreSubsystem::GetValue(int32 Handle, EAEOA_Attribute Attribute) const
+{
+	const TArray<float>& Values = Columns[static_cast<int32>(Attribute)].Values;
+	return Values.IsValidIndex(Handle) ? Values[Handle] : 0.f;
+}
+
+// --- GetMaxValue ---
+float UAEOA_AttributeStoreSubsystem::GetMaxValue(int32 Handle, EAEOA_Attribute Attribute) const
+{
+	const TArray<float>& MaxValues = Columns[static_cast<int32>(Attribute)].MaxValues;
+	return MaxValues.IsValidIndex(Handle) ? MaxValues[Handle] : 0.f;
+}
+
+// --- ApplyBulkDamage ---
+// Damage is summed per entry on the game thread, so the parallel pass never writes an entry twice.
+void UAEOA_AttributeStoreSubsystem::ApplyBulkDamage(TConstArrayView<FAEOA_AttributeDamage> Damages)
+{
+	for (const FAEOA_AttributeDamage& Damage : Damages)
+	{
+		if (PendingDamage.IsValidIndex(Damage.Handle))
+		{
+			PendingDamage[Damage.Handle] += Damage.Amount;
+		}
+	}
+
+	RunPass(0.f);
+	DispatchChanges();
+}
+
+// --- Tick ---
+void UAEOA_AttributeStoreSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate < CVarAttributesUpdateInterval.GetValueOnGameThread()) return;
+
+	RunPass(TimeSinceUpdate);
+	TimeSinceUpdate = 0.f;
+	DispatchChanges();
+
+	SET_DWORD_STAT(STAT_AEOA_AttributeEntries, Components.Num() - FreeHandles.Num());
+}
+
+// --- RunPass ---
+// Each worker only touches the entries of its own indices, and notifications wait for the game thread.
+// Health does not regenerate once it reaches zero, so regeneration never revives the dead.
+void UAEOA_AttributeStoreSubsystem::RunPass(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_AttributePass);
+
+	const int32 NumEntries = Components.Num();
+	const EParallelForFlags Flags = NumEntries < CVarAttributesMinParallelEntries.GetValueOnGameThread()
+		? EParallelForFlags::ForceSingleThread
+		: EParallelForFlags::None;
+
+	ParallelFor(NumEntries, [this, DeltaTime](int32 Handle)
+	{
+		if (!Components[Handle]) return;
+
+		uint8 ChangedMask = 0;
+		for (int32 AttributeIndex = 0; AttributeIndex < NumAttributes; ++AttributeIndex)
+		{
+			FAttributeColumn& Column = Columns[AttributeIndex];
+			const float OldValue = Column.Values[Handle];
+
+			float NewValue = OldValue + Column.RegenRates[Handle] * DeltaTime;
+			if (AttributeIndex == static_cast<int32>(EAEOA_Attribute::EA_Health))
+			{
+				NewValue = OldValue > 0.f ? NewValue - PendingDamage[Handle] : OldValue;
+			}
+			NewValue = FMath::Clamp(NewValue, 0.f, Column.MaxValues[Handle]);
+
+			if (NewValue != OldValue)
+			{
+				Column.PreviousValues[Handle] = OldValue;
+				Column.Values[Handle] = NewValue;
+				ChangedMask |= 1 << AttributeIndex;
+			}
+		}
+		PendingDamage[Handle] = 0.f;
+		ChangedMasks[Handle] |= ChangedMask;
+	}, Flags);
+}
+
+// --- DispatchChanges ---
+// Handlers may add or remove entries, so the count and the components are re-read for every entry.
+void UAEOA_AttributeStoreSubsystem::DispatchChanges()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_AttributeDispatch);
+
+	int32 NumChanges = 0;
+	for (int32 Handle = 0; Handle < ChangedMasks.Num(); ++Handle)
+	{
+		const uint8 ChangedMask = ChangedMasks[Handle];
+		if (ChangedMask == 0) continue;
+		ChangedMasks[Handle] = 0;
+
+		for (int32 AttributeIndex = 0; AttributeIndex < NumAttributes; ++AttributeIndex)
+		{
+			if (!(ChangedMask & (1 << AttributeIndex)) || !Components[Handle]) continue;
+
+			const FAttributeColumn& Column = Columns[AttributeIndex];
+			Components[Handle]->HandleAttributeChanged(static_cast<EAEOA_Attribute>(AttributeIndex), Column.PreviousValues[Handle], Column.Values[Handle]);
+			++NumChanges;
+		}
+	}
+	SET_DWORD_STAT(STAT_AEOA_AttributeChanges, NumChanges);
+}
@@ -0,0 +1,136 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_HurtboxComponent class, creating the query-only
+// hurtbox shapes of hittable actors on the Hurtbox collision channel.
+
+#include "Components/AEOA_HurtboxComponent.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "EchoesOfTheAncients/AEOA_CollisionChannels.h"
+#include "GameFramework/Actor.h"
+
+// --- Constructor ---
+UAEOA_HurtboxComponent::UAEOA_HurtboxComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+// --- BeginPlay ---
+// Without entries, the owner's capsule (character or breakable) gives the default shape.
+void UAEOA_HurtboxComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (Shapes.Num() == 0)
+	{
+		if (const UCapsuleComponent* OwnerCapsule = GetOwner()->FindComponentByClass<UCapsuleComponent>())
+		{
+			FAEOA_HurtboxShape DefaultShape;
+			DefaultShape.ShapeName = FName("Body");
+			DefaultShape.Extent = FVector(OwnerCapsule->GetUnscaledCapsuleRadius(), 0.f, OwnerCapsule->GetUnscaledCapsuleHalfHeight());
+			DefaultShape.RelativeTransform = OwnerCapsule->GetComponentTransform().GetRelativeTransform(GetComponentTransform());
+			Shapes.Add(DefaultShape);
+		}
+	}
+
+	ShapeComponents.Reserve(Shapes.Num());
+	DamageMultipliers.Reserve(Shapes.Num());
+	for (const FAEOA_HurtboxShape& Shape : Shapes)
+	{
+		ShapeComponents.Add(CreateShape(Shape));
+		DamageMultipliers.Add(Shape.DamageMultiplier);
+	}
+}
+
+// --- EndPlay ---
+void UAEOA_HurtboxComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (UShapeComponent* ShapeComponent : ShapeComponents)
+	{
+		if (ShapeComponent)
+		{
+			ShapeComponent->DestroyComponent();
+		}
+	}
+	ShapeComponents.Reset();
+	DamageMultipliers.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// --- CreateShape ---
+UShapeComponent* UAEOA_HurtboxComponent::CreateShape(const FAEOA_HurtboxShape& Shape)
+{
+	UShapeComponent* ShapeComponent = nullptr;
+	switch (Shape.ShapeType)
+	{
+	case EAEOA_HurtboxShapeType::EHST_Sphere:
+	{
+		USphereComponent* Sphere = NewObject<USphereComponent>(this);
+		Sphere->InitSphereRadius(Shape.Extent.X);
+		ShapeComponent = Sphere;
+		break;
+	}
+	case EAEOA_HurtboxShapeType::EHST_Capsule:
+	{
+		UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(this);
+		Capsule->InitCapsuleSize(Shape.Extent.X, Shape.Extent.Z);
+		ShapeComponent = Capsule;
+		break;
+	}
+	case EAEOA_HurtboxShapeType::EHST_Box:
+	default:
+	{
+		UBoxComponent* Box = NewObject<UBoxComponent>(this);
+		Box->InitBoxExtent(Shape.Extent);
+		ShapeComponent = Box;
+		break;
+	}
+	}
+
+	// Query only on the Hurtbox channel: no physics, invisible to navigation and movement.
+	// Overlap events stay on for weapons that toggle their WeaponBox instead of sweeping the blade;
+	// the profile only overlaps the WeaponBox channel, so they never match other objects.
+	ShapeComponent->SetCollisionProfileName(AEOA_PROFILE_HURTBOX);
+	ShapeComponent->SetGenerateOverlapEvents(true);
+	ShapeComponent->SetCanEverAffectNavigation(false);
+	ShapeComponent->CanCharacterStepUpOn = ECB_No;
+
+	// Shapes with a bone follow it on the owner's skeletal mesh; the others follow the hurtbox component.
+	USkeletalMeshComponent* OwnerMesh = Shape.BoneName.IsNone() ? nullptr : GetOwner()->FindComponentByClass<USkeletalMeshComponent>();
+	if (OwnerMesh)
+	{
+		ShapeComponent->SetupAttachment(OwnerMesh, Shape.BoneName);
+	}
+	else
+	{
+		ShapeComponent->SetupAttachment(this);
+	}
+	ShapeComponent->SetRelativeTransform(Shape.RelativeTransform);
+	ShapeComponent->RegisterComponent();
+	return ShapeComponent;
+}
+
+// --- SetHurtboxEnabled ---
+void UAEOA_HurtboxComponent::SetHurtboxEnabled(bool bEnabled)
+{
+	for (UShapeComponent* ShapeComponent : ShapeComponents)
+	{
+		if (ShapeComponent)
+		{
+			ShapeComponent->SetCollisionEnabled(bEnabled ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
+		}
+	}
+}
+
+// --- GetDamageMultiplier ---
+// Shapes are created with the hurtbox as their outer, so the owning hurtbox is found without searching the actor.
+float UAEOA_HurtboxComponent::GetDamageMultiplier(const UPrimitiveComponent* HitComponent)
+{
+	const UAEOA_HurtboxComponent* Hurtbox = HitComponent ? Cast<UAEOA_HurtboxComponent>(HitComponent->GetOuter()) : nullptr;
+	if (!Hurtbox) return 1.f;
+
+	const int32 Index = Hurtbox->ShapeComponents.IndexOfByKey(HitComponent);
+	return Hurtbox->DamageMultipliers.IsValidIndex(Index) ? Hurtbox->DamageMultipliers[Index] : 1.f;
+}
@@ -3,37 +3,73 @@
 // properties for enemies in Echoes of the Ancients.
 
 #include "Enemies/AEOA_Enemy.h"
-#include "UI/HUD/AEOA_HealthBarComponent.h"
 #include "Animation/AnimMontage.h"
+#include "Combat/AEOA_CombatAwarenessSubsystem.h"
+#include "Combat/AEOA_HittableGridSubsystem.h"
+#include "Combat/AEOA_StatusEffectSubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "Components/AEOA_AttributeComponent.h"
+#include "Components/AEOA_HurtboxComponent.h"
+#include "Enemies/AEOA_EnemyCrowdSubsystem.h"
+#include "Enemies/AEOA_EnemyPoolSubsystem.h"
+#include "Enemies/AEOA_EnemySignificanceSubsystem.h"
+#include "Enemies/AEOA_EnemyThinkSubsystem.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
 #include "EchoesOfTheAncients/DebugMacros.h"
+#include "HAL/IConsoleManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "UI/HUD/AEOA_HealthBarSubsystem.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Frozen Corpses"), STAT_AEOA_FrozenCorpses, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<bool> CVarEnemyFreezeCorpses(
+	TEXT("AEOA.Enemy.FreezeCorpses"),
+	true,
+	TEXT("Freeze the pose of dead enemies once their death montage ends, turning off their animation, movement and ticks. 0 keeps corpses animating until they are recycled."),
+	ECVF_Default);
+
+// Section names are built once at module load; the tables resolve them against the montages once per enemy.
+static const FName DeathSectionNames[] = { FName("Death1"), FName("Death2"), FName("Death3"), FName("Death4") };
+
+/// Entries of the hit react section table, named after the side the hit came from.
+enum EAEOA_HitReactSection : int32
+{
+	HRS_FromFront,
+	HRS_FromLeft,
+	HRS_FromRight,
+	HRS_FromBack
+};
+static const FName HitReactSectionNames[] = { FName("FromFront"), FName("FromLeft"), FName("FromRight"), FName("FromBack") };
 
 // --- Constructor ---
 // Sets default values for the enemy’s properties and components.
 AAEOA_Enemy::AAEOA_Enemy()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	DeathSections.Init(DeathSectionNames);
+	HitReactSections.Init(HitReactSectionNames);
 
-	// Configure the skeletal mesh component for collision and hit detection.
-	GetMesh()->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);  // Set object type to WorldDynamic to be hit by weapon box trace.
-	GetMesh()->SetCollisionResponseToChannel(ECollisionChannel::ECC_Visibility, ECollisionResponse::ECR_Block);  // Block Visibility channel for box trace hits.
+	// Combat range is tracked by UAEOA_CombatAwarenessSubsystem, so the enemy itself never ticks.
+	PrimaryActorTick.bCanEverTick = false;
+
+	// Weapons hit the hurtbox shapes, so the physics bodies of the skeletal mesh take no part in combat queries.
 	GetMesh()->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);  // Ignore Camera channel to prevent camera collision issues.
-	GetMesh()->SetGenerateOverlapEvents(true);  // Enable overlap events to trigger weapon box overlaps.
+	GetMesh()->SetGenerateOverlapEvents(false);
 
 	// Configure the capsule component to ignore camera collision.
 	GetCapsuleComponent()->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);
 
+	// Create the Hurtbox component holding the shapes weapons can hit (head, torso, limbs), set up in Blueprints.
+	Hurtbox = CreateDefaultSubobject<UAEOA_HurtboxComponent>(TEXT("Hurtbox"));
+	Hurtbox->SetupAttachment(GetRootComponent());
+
 	// Create the Attributes component to manage enemy health.
 	Attributes = CreateDefaultSubobject<UAEOA_AttributeComponent>(TEXT("Attributes"));
 
-	// Create the HealthBarWidget component to display the health bar above the enemy.
-	HealthBarWidget = CreateDefaultSubobject<UAEOA_HealthBarComponent>(TEXT("HealthBar"));
-	HealthBarWidget->SetupAttachment(GetRootComponent());
+	// The health bar is drawn by UAEOA_HealthBarSubsystem, with a slot allocated only once the enemy is hit.
 }
 
 // --- BeginPlay ---
@@ -41,94 +77,351 @@ AAEOA_Enemy::AAEOA_Enemy()
 void AAEOA_Enemy::BeginPlay()
 {
 	Super::BeginPlay();
-	
-	// Hide the health bar by default until the enemy is hit, improving performance and visibility.
-	if (HealthBarWidget)
+
+	// The health bar follows health changes instead of being refreshed by every caller that may change health.
+	if (Attributes)
 	{
-		HealthBarWidget->SetVisibility(false);
+		Attributes->OnHealthChanged.AddUObject(this, &AAEOA_Enemy::HandleHealthChanged);
 	}
+
+	// Resolve the montage sections now rather than on the first hit.
+	DeathSections.Build(DeathMontage);
+	HitReactSections.Build(HitReactMontage);
+
+	RegisterWithWorldSubsystems();
 }
 
-void AAEOA_Enemy::Die()
+// --- EndPlay ---
+// Called when the enemy is removed from the world, removes it from the world subsystems tracking it.
+void AAEOA_Enemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-	if (AnimInstance && DeathMontage)
+	GetWorldTimerManager().ClearTimer(CorpseTimerHandle);
+	GetWorldTimerManager().ClearTimer(CorpseFreezeTimerHandle);
+	ReleaseHealthBar();
+	if (bCorpseFrozen)
 	{
-		AnimInstance->Montage_Play(DeathMontage);
-		const int32 Selection = FMath::RandRange(0, 3);  // We have 4 animations (Death_1 to Death_4).
-		FName SectionName = FName();
-		switch (Selection)
-		{
-		case 0:
-			SectionName = FName("Death1");
-			DeathPose = EDeathPose::EDP_Death1;
-			break;
-		case 1:
-			SectionName = FName("Death2");
-			DeathPose = EDeathPose::EDP_Death2;
-			break;
-		case 2:
-			SectionName = FName("Death3");
-			DeathPose = EDeathPose::EDP_Death3;
-			break;
-		case 3:
-			SectionName = FName("Death4");
-			DeathPose = EDeathPose::EDP_Death4;
-			break;
-		default:
-			break;
-		}
-		AnimInstance->Montage_JumpToSection(SectionName, DeathMontage);
+		bCorpseFrozen = false;
+		DEC_DWORD_STAT(STAT_AEOA_FrozenCorpses);
+	}
+	UnregisterFromWorldSubsystems();
+
+	Super::EndPlay(EndPlayReason);
+}
 
+// --- RegisterWithWorldSubsystems ---
+void AAEOA_Enemy::RegisterWithWorldSubsystems()
+{
+	// Make the enemy visible to area-of-effect queries; it moves, so the grid follows it every frame.
+	if (UAEOA_HittableGridSubsystem* HittableGrid = GetWorld()->GetSubsystem<UAEOA_HittableGridSubsystem>())
+	{
+		HittableGrid->RegisterHittable(this, true);
 	}
 
-	// Hide the health bar upon death to clean up the UI.
-	if (HealthBarWidget)
+	// Let the significance subsystem throttle the ticks of the enemy when it is far from Aria or unseen.
+	if (UAEOA_EnemySignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UAEOA_EnemySignificanceSubsystem>())
+	{
+		SignificanceSubsystem->RegisterEnemy(this);
+	}
+
+	// Decision logic runs in the think scheduler's frame budget rather than in a tick of its own.
+	if (UAEOA_EnemyThinkSubsystem* ThinkScheduler = GetWorld()->GetSubsystem<UAEOA_EnemyThinkSubsystem>())
+	{
+		ThinkScheduler->RegisterEnemy(this);
+	}
+
+	// Enemies of crowd classes, however they were spawned, return to the crowd when they wander far from Aria.
+	if (UAEOA_EnemyCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UAEOA_EnemyCrowdSubsystem>())
+	{
+		Crowd->RegisterEnemy(this);
+	}
+}
+
+// --- UnregisterFromWorldSubsystems ---
+void AAEOA_Enemy::UnregisterFromWorldSubsystems()
+{
+	if (UAEOA_EnemyCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UAEOA_EnemyCrowdSubsystem>())
+	{
+		Crowd->UnregisterEnemy(this);
+	}
+	if (UAEOA_EnemyThinkSubsystem* ThinkScheduler = GetWorld()->GetSubsystem<UAEOA_EnemyThinkSubsystem>())
+	{
+		ThinkScheduler->UnregisterEnemy(this);
+	}
+	if (UAEOA_EnemySignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UAEOA_EnemySignificanceSubsystem>())
+	{
+		SignificanceSubsystem->UnregisterEnemy(this);
+	}
+	if (UAEOA_HittableGridSubsystem* HittableGrid = GetWorld()->GetSubsystem<UAEOA_HittableGridSubsystem>())
+	{
+		HittableGrid->UnregisterHittable(this);
+	}
+	if (UAEOA_CombatAwarenessSubsystem* CombatAwareness = GetWorld()->GetSubsystem<UAEOA_CombatAwarenessSubsystem>())
+	{
+		CombatAwareness->Disengage(this);
+	}
+	if (UAEOA_StatusEffectSubsystem* StatusEffects = GetWorld()->GetSubsystem<UAEOA_StatusEffectSubsystem>())
+	{
+		StatusEffects->ClearEffects(this);
+	}
+}
+
+// --- OnAcquiredFromPool ---
+// Restores everything Die() and OnReleasedToPool() changed, so a recycled enemy is indistinguishable from a fresh one.
+void AAEOA_Enemy::OnAcquiredFromPool()
+{
+	if (Attributes)
+	{
+		Attributes->ResetHealth();
+	}
+	SetHealthBarVisible(false);
+	DeathPose = EDeathPose::EDP_Alive;
+	CombatTarget = nullptr;
+
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	Hurtbox->SetHurtboxEnabled(true);
+
+	GetMesh()->SetComponentTickEnabled(true);
+	GetCharacterMovement()->Activate(true);
+	GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Walking);
+
+	RegisterWithWorldSubsystems();
+}
+
+// --- OnReleasedToPool ---
+void AAEOA_Enemy::OnReleasedToPool()
+{
+	GetWorldTimerManager().ClearTimer(CorpseTimerHandle);
+	UnregisterFromWorldSubsystems();
+
+	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
-		HealthBarWidget->SetVisibility(false);
+		AnimInstance->StopAllMontages(0.f);
 	}
+	// Stopping a death montage still playing runs OnDeathMontageEnded, which schedules a freeze; cancel it afterwards.
+	GetWorldTimerManager().ClearTimer(CorpseFreezeTimerHandle);
+	// Parked enemies give their health bar slot back, for reuse by active enemies.
+	ReleaseHealthBar();
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	Hurtbox->SetHurtboxEnabled(false);
+
+	// Parked enemies are hidden and tick-disabled anyway; unfreezing now lets the next acquisition animate right away.
+	UnfreezeCorpse();
+
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->Deactivate();
+	GetMesh()->SetComponentTickEnabled(false);
+}
+
+// --- OnCorpseExpired ---
+// The corpse goes back to the pool when one exists, otherwise it is destroyed as before.
+void AAEOA_Enemy::OnCorpseExpired()
+{
+	if (UAEOA_EnemyPoolSubsystem* EnemyPool = GetWorld()->GetSubsystem<UAEOA_EnemyPoolSubsystem>())
+	{
+		EnemyPool->ReleaseEnemy(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+void AAEOA_Enemy::Die()
+{
+	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
+	const int32 Selection = FMath::RandRange(0, DeathSections.Num() - 1);  // We have 4 animations (Death_1 to Death_4).
+	DeathPose = static_cast<EDeathPose>(static_cast<uint8>(EDeathPose::EDP_Death1) + Selection);
+	if (DeathSections.Play(AnimInstance, DeathMontage, Selection))
+	{
+		// Freeze the corpse once the death section has played out and the montage has blended into the death pose.
+		FOnMontageEnded DeathMontageEndedDelegate;
+		DeathMontageEndedDelegate.BindUObject(this, &AAEOA_Enemy::OnDeathMontageEnded);
+		AnimInstance->Montage_SetEndDelegate(DeathMontageEndedDelegate, DeathMontage);
+	}
+	else
+	{
+		FreezeCorpse();
+	}
+
+	// Hide the health bar upon death to clean up the UI.
+	SetHealthBarVisible(false);
 
 	// Disable capsule collision to allow Aria to pass through the defeated enemy.
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
-	// Set a lifespan to destroy the enemy after 3 seconds, preventing clutter in the level.
-	SetLifeSpan(6.f);
+	// The defeated enemy stops thinking; weapons and area-of-effect queries can no longer hit it.
+	if (UAEOA_EnemyThinkSubsystem* ThinkScheduler = GetWorld()->GetSubsystem<UAEOA_EnemyThinkSubsystem>())
+	{
+		ThinkScheduler->UnregisterEnemy(this);
+	}
+	Hurtbox->SetHurtboxEnabled(false);
+	if (UAEOA_HittableGridSubsystem* HittableGrid = GetWorld()->GetSubsystem<UAEOA_HittableGridSubsystem>())
+	{
+		HittableGrid->UnregisterHittable(this);
+	}
+	if (UAEOA_CombatAwarenessSubsystem* CombatAwareness = GetWorld()->GetSubsystem<UAEOA_CombatAwarenessSubsystem>())
+	{
+		CombatAwareness->Disengage(this);
+	}
+	// Lingering bleeds and burns stop with the enemy, and a slow no longer holds its walk speed.
+	if (UAEOA_StatusEffectSubsystem* StatusEffects = GetWorld()->GetSubsystem<UAEOA_StatusEffectSubsystem>())
+	{
+		StatusEffects->ClearEffects(this);
+	}
+
+	// Keep the corpse for CorpseLifeSpan seconds, then recycle the enemy through the pool.
+	GetWorldTimerManager().SetTimer(CorpseTimerHandle, this, &AAEOA_Enemy::OnCorpseExpired, CorpseLifeSpan, false);
 }
 
-// --- Tick ---
-// Called every frame.
-void AAEOA_Enemy::Tick(float DeltaTime)
+// --- OnDeathMontageEnded ---
+void AAEOA_Enemy::OnDeathMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
-	Super::Tick(DeltaTime);
+	if (DeathPose == EDeathPose::EDP_Alive) return;
 
-	// Check if the combat target is still within range; if not, 
-	// hide the health bar and clear the target.
-	if (CombatTarget)
+	if (CorpseFreezeDelay > 0.f)
 	{
-		const double DistanceToTarget = (CombatTarget->GetActorLocation() - GetActorLocation()).Size();
-		if (DistanceToTarget > CombatRadius)
-		{
-			CombatTarget = nullptr;
-			if (HealthBarWidget)
-			{
-				HealthBarWidget->SetVisibility(false);
-			}
-		}
+		GetWorldTimerManager().SetTimer(CorpseFreezeTimerHandle, this, &AAEOA_Enemy::FreezeCorpse, CorpseFreezeDelay, false);
+	}
+	else
+	{
+		FreezeCorpse();
 	}
 }
 
-void AAEOA_Enemy::PlayHitReactMontage(const FName& SectionName)
+// --- FreezeCorpse ---
+// A skeletal mesh that no longer ticks keeps its last bone transforms on the render thread,
+// so the corpse stays in its death pose without evaluating animation or updating its skeleton.
+void AAEOA_Enemy::FreezeCorpse()
 {
-	// Get the animation instance from the enemy’s mesh.
-	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-	// Check if the anim instance and hit react montage are valid before proceeding.
-	if (AnimInstance && HitReactMontage)
+	if (bCorpseFrozen || DeathPose == EDeathPose::EDP_Alive || !CVarEnemyFreezeCorpses.GetValueOnGameThread()) return;
+	bCorpseFrozen = true;
+	INC_DWORD_STAT(STAT_AEOA_FrozenCorpses);
+
+	// The significance subsystem has nothing left to throttle.
+	if (UAEOA_EnemySignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UAEOA_EnemySignificanceSubsystem>())
 	{
-		// Play the hit react montage with default settings.
-		AnimInstance->Montage_Play(HitReactMontage);
-		// Jump to the specified section in the hit react montage.
-		AnimInstance->Montage_JumpToSection(SectionName, HitReactMontage);
+		SignificanceSubsystem->UnregisterEnemy(this);
 	}
+
+	USkeletalMeshComponent* MeshComponent = GetMesh();
+	MeshComponent->bPauseAnims = true;
+	MeshComponent->bNoSkeletonUpdate = true;
+	MeshComponent->SetComponentTickEnabled(false);
+
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->Deactivate();
+	SetActorTickEnabled(false);
+}
+
+// --- UnfreezeCorpse ---
+void AAEOA_Enemy::UnfreezeCorpse()
+{
+	if (!bCorpseFrozen) return;
+	bCorpseFrozen = false;
+	DEC_DWORD_STAT(STAT_AEOA_FrozenCorpses);
+
+	USkeletalMeshComponent* MeshComponent = GetMesh();
+	MeshComponent->bPauseAnims = false;
+	MeshComponent->bNoSkeletonUpdate = false;
+	MeshComponent->SetComponentTickEnabled(true);
+}
+
+// --- Think ---
+// Enemies have no decision logic of their own yet; Blueprint subclasses override Think to add it.
+void AAEOA_Enemy::Think_Implementation(float DeltaSinceLastThink)
+{
+}
+
+// --- SetHealthBarVisible ---
+// Most enemies are never hit, so they never take a slot in the health bar layer.
+void AAEOA_Enemy::SetHealthBarVisible(bool bVisible)
+{
+	UAEOA_HealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UAEOA_HealthBarSubsystem>();
+	if (!HealthBars) return;
+
+	if (HealthBarSlot == INDEX_NONE)
+	{
+		if (!bVisible) return;
+
+		HealthBarSlot = HealthBars->AllocateBar(this, HealthBarOffset);
+		UpdateHealthBarPercent();
+	}
+	HealthBars->SetBarVisible(HealthBarSlot, bVisible);
+}
+
+// --- UpdateHealthBarPercent ---
+void AAEOA_Enemy::UpdateHealthBarPercent()
+{
+	if (HealthBarSlot == INDEX_NONE || !Attributes) return;
+
+	if (UAEOA_HealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UAEOA_HealthBarSubsystem>())
+	{
+		HealthBars->SetBarPercent(HealthBarSlot, Attributes->GetHealthPercent());
+	}
+}
+
+// --- HandleHealthChanged ---
+// Health can also run out between hits, e.g., from a bleed, so the enemy dies as soon as it reaches zero.
+void AAEOA_Enemy::HandleHealthChanged(UAEOA_AttributeComponent* Component, float OldHealth, float NewHealth)
+{
+	UpdateHealthBarPercent();
+
+	if (OldHealth > 0.f && NewHealth <= 0.f && DeathPose == EDeathPose::EDP_Alive)
+	{
+		Die();
+	}
+}
+
+// --- ReleaseHealthBar ---
+void AAEOA_Enemy::ReleaseHealthBar()
+{
+	if (HealthBarSlot == INDEX_NONE) return;
+
+	if (UAEOA_HealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UAEOA_HealthBarSubsystem>())
+	{
+		HealthBars->ReleaseBar(HealthBarSlot);
+	}
+	HealthBarSlot = INDEX_NONE;
+}
+
+// --- OnCombatRangeChanged ---
+// The health bar is only shown while the target that engaged the enemy stays close.
+void AAEOA_Enemy::OnCombatRangeChanged(bool bInRange)
+{
+	SetHealthBarVisible(bInRange && IsAlive());
+	if (bInRange) return;
+
+	CombatTarget = nullptr;
+	if (UAEOA_CombatAwarenessSubsystem* CombatAwareness = GetWorld()->GetSubsystem<UAEOA_CombatAwarenessSubsystem>())
+	{
+		CombatAwareness->Disengage(this);
+	}
+}
+
+// --- ApplyCrowdState ---
+// Runs right after OnAcquiredFromPool, so the enemy resumes exactly where the crowd entity left off.
+void AAEOA_Enemy::ApplyCrowdState(float Health)
+{
+	if (Attributes)
+	{
+		Attributes->SetHealth(Health);
+	}
+}
+
+// --- IsAlive ---
+bool AAEOA_Enemy::IsAlive() const
+{
+	return Attributes && Attributes->GetHealth() > 0.f;
+}
+
+void AAEOA_Enemy::PlayHitReactMontage(int32 SectionEntry)
+{
+	// Start the hit react montage directly at the section resolved for this direction.
+	HitReactSections.Play(GetMesh()->GetAnimInstance(), HitReactMontage, SectionEntry);
 }
 
 // --- SetupPlayerInputComponent ---
@@ -145,10 +438,7 @@ void AAEOA_Enemy::SetupPlayerInputComponent(UInputComponent* PlayerInputComponen
 void AAEOA_Enemy::GetHit_Implementation(const FVector& ImpactPoint)
 {
 	// Show the health bar when the enemy is hit to indicate combat engagement.
-	if (HealthBarWidget)
-	{
-		HealthBarWidget->SetVisibility(true);
-	}
+	SetHealthBarVisible(true);
 	
 	// DRAW_SPHERE_COLOR(ImpactPoint, FColor::Orange);  // Draw an orange sphere at the impact point for 5 seconds.
 
@@ -156,7 +446,7 @@ void AAEOA_Enemy::GetHit_Implementation(const FVector& ImpactPoint)
 	{
 		DirectionalHitReact(ImpactPoint);
 	}
-	else
+	else if (DeathPose == EDeathPose::EDP_Alive)
 	{
 		Die();
 	}
@@ -214,26 +504,26 @@ void AAEOA_Enemy::DirectionalHitReact(const FVector& ImpactPoint)
 	}
 
 	// Determine the montage section based on Theta.
-	FName Section("FromBack");  // Default to FromBack if none of the conditions match.
+	int32 Section = HRS_FromBack;  // Default to FromBack if none of the conditions match.
 	if (Theta >= -45.f && Theta < 45.f)
 	{
-		Section = FName("FromFront");  // Hit from the front, stumble backward.
+		Section = HRS_FromFront;  // Hit from the front, stumble backward.
 	}
 	else if (Theta >= -135.f && Theta < -45.f)
 	{
-		Section = FName("FromLeft");  // Hit from the left, stumble right.
+		Section = HRS_FromLeft;  // Hit from the left, stumble right.
 	}
 	else if (Theta >= 45.f && Theta < 135.f)
 	{
-		Section = FName("FromRight");  // Hit from the right, stumble left.
+		Section = HRS_FromRight;  // Hit from the right, stumble left.
 	}
-	// If Theta is >= 135 or < -135, Section remains "FromBack" (hit from behind, stumble forward).
+	// If Theta is >= 135 or < -135, Section remains FromBack (hit from behind, stumble forward).
 
 
-	PlayHitReactMontage(FName(Section));
+	PlayHitReactMontage(Section);
 }
 
-/// Handles damage application, reducing health and updating the health bar.
+/// Handles damage application, reducing health (the health bar follows through OnHealthChanged).
 /// @param DamageAmount The amount of damage to apply.
 /// @param DamageEvent The damage event data.
 /// @param EventInstigator The controller responsible for the damage.
@@ -241,13 +531,23 @@ void AAEOA_Enemy::DirectionalHitReact(const FVector& ImpactPoint)
 /// @return The amount of damage actually applied.
 float AAEOA_Enemy::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
-	if (Attributes && HealthBarWidget)
+	if (Attributes)
 	{
 		Attributes->ReceiveDamage(DamageAmount);
-		HealthBarWidget->SetHealthPercent(Attributes->GetHealthPercent());
 	}
 
-	// Set the combat target to the pawn that caused the damage for health bar visibility management.
-	CombatTarget = EventInstigator->GetPawn();
+	// Set the combat target to the pawn that caused the damage, and let the awareness subsystem report when it leaves CombatRadius.
+	CombatTarget = EventInstigator ? EventInstigator->GetPawn() : nullptr;
+	if (UAEOA_CombatAwarenessSubsystem* CombatAwareness = GetWorld()->GetSubsystem<UAEOA_CombatAwarenessSubsystem>())
+	{
+		if (CombatTarget && Attributes && Attributes->IsAlive())
+		{
+			CombatAwareness->Engage(this, CombatTarget, CombatRadius);
+		}
+		else
+		{
+			CombatAwareness->Disengage(this);
+		}
+	}
 	return DamageAmount;
 }
\ No newline at end of file
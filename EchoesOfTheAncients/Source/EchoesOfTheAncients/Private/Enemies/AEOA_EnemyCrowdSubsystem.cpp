@@ -0,0 +1,330 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_EnemyCrowdSubsystem class, simulating distant
+// enemies as instanced crowd entities and swapping them with actors near Aria.
+
+#include "Enemies/AEOA_EnemyCrowdSubsystem.h"
+#include "Enemies/AEOA_Enemy.h"
+#include "Enemies/AEOA_EnemyPoolSubsystem.h"
+#include "Components/AEOA_AttributeComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_CYCLE_STAT(TEXT("Crowd Simulation"), STAT_AEOA_CrowdSimulation, STATGROUP_EchoesOfTheAncients);
+DECLARE_CYCLE_STAT(TEXT("Crowd Promotions"), STAT_AEOA_CrowdPromotions, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crowd Entities"), STAT_AEOA_CrowdEntities, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Crowd Promoted Enemies"), STAT_AEOA_CrowdPromoted, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarCrowdPromoteRadius(
+	TEXT("AEOA.Crowd.PromoteRadius"),
+	3000.f,
+	TEXT("Crowd entities closer to Aria than this distance are promoted to enemy actors, in Unreal units."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCrowdDemoteRadius(
+	TEXT("AEOA.Crowd.DemoteRadius"),
+	3500.f,
+	TEXT("Promoted enemies farther from Aria than this distance return to the crowd. Keep above PromoteRadius to avoid flip-flopping."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCrowdUpdateInterval(
+	TEXT("AEOA.Crowd.UpdateInterval"),
+	0.2f,
+	TEXT("Seconds between two promotion and demotion passes."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCrowdMaxSwapsPerUpdate(
+	TEXT("AEOA.Crowd.MaxSwapsPerUpdate"),
+	4,
+	TEXT("Maximum number of promotions plus demotions per pass, spreading actor activation over several frames."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCrowdAcceptanceRadius(
+	TEXT("AEOA.Crowd.AcceptanceRadius"),
+	150.f,
+	TEXT("Crowd entities stop walking when this close to their target, in Unreal units."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_EnemyCrowdSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_EnemyCrowdSubsystem::Deinitialize()
+{
+	Archetypes.Empty();
+	TrackedEnemies.Empty();
+	TrackedTargets.Empty();
+	InstanceOwner = nullptr;
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_EnemyCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_EnemyCrowdSubsystem, STATGROUP_Tickables);
+}
+
+// --- GetNumEntities ---
+int32 UAEOA_EnemyCrowdSubsystem::GetNumEntities() const
+{
+	int32 NumEntities = 0;
+	for (const FAEOA_CrowdArchetype& Archetype : Archetypes)
+	{
+		NumEntities += Archetype.Positions.Num();
+	}
+	return NumEntities;
+}
+
+// --- SpawnCrowdEnemy ---
+bool UAEOA_EnemyCrowdSubsystem::SpawnCrowdEnemy(TSubclassOf<AAEOA_Enemy> EnemyClass, const FVector& Location, const FRotator& Rotation, AActor* Target)
+{
+	const int32 ArchetypeIndex = FindOrAddArchetype(EnemyClass);
+	if (ArchetypeIndex == INDEX_NONE) return false;
+
+	const UAEOA_AttributeComponent* DefaultAttributes = EnemyClass->GetDefaultObject<AAEOA_Enemy>()->GetAttributes();
+	AddEntity(ArchetypeIndex, Location, Rotation.Yaw, DefaultAttributes ? DefaultAttributes->GetMaxHealth() : 100.f, Target);
+	return true;
+}
+
+// --- RegisterEnemy ---
+void UAEOA_EnemyCrowdSubsystem::RegisterEnemy(AAEOA_Enemy* Enemy)
+{
+	if (!Enemy || !Enemy->GetCrowdMesh() || TrackedEnemies.Contains(Enemy)) return;
+
+	TrackedEnemies.Add(Enemy);
+	TrackedTargets.Add(nullptr);
+}
+
+// --- UnregisterEnemy ---
+void UAEOA_EnemyCrowdSubsystem::UnregisterEnemy(AAEOA_Enemy* Enemy)
+{
+	const int32 Index = TrackedEnemies.IndexOfByKey(Enemy);
+	if (Index == INDEX_NONE) return;
+
+	TrackedEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TrackedTargets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// --- FindOrAddArchetype ---
+// The instance offset and speed come from the class defaults, so instances stand exactly where the character's mesh would.
+int32 UAEOA_EnemyCrowdSubsystem::FindOrAddArchetype(TSubclassOf<AAEOA_Enemy> EnemyClass)
+{
+	if (!EnemyClass) return INDEX_NONE;
+
+	const int32 Existing = Archetypes.IndexOfByPredicate([EnemyClass](const FAEOA_CrowdArchetype& Archetype)
+	{
+		return Archetype.EnemyClass == EnemyClass;
+	});
+	if (Existing != INDEX_NONE) return Existing;
+
+	const AAEOA_Enemy* DefaultEnemy = EnemyClass->GetDefaultObject<AAEOA_Enemy>();
+	if (!DefaultEnemy->GetCrowdMesh()) return INDEX_NONE;
+
+	if (!InstanceOwner)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		InstanceOwner = GetWorld()->SpawnActor<AActor>(SpawnParams);
+	}
+
+	UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(InstanceOwner);
+	Instances->SetStaticMesh(DefaultEnemy->GetCrowdMesh());
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetGenerateOverlapEvents(false);
+	Instances->SetCanEverAffectNavigation(false);
+	Instances->bSupportRemoveAtSwap = true;
+	Instances->SetMobility(EComponentMobility::Movable);
+	Instances->RegisterComponent();
+
+	FAEOA_CrowdArchetype& Archetype = Archetypes.AddDefaulted_GetRef();
+	Archetype.EnemyClass = EnemyClass;
+	Archetype.Instances = Instances;
+	Archetype.MeshOffset = DefaultEnemy->GetMesh()->GetRelativeTransform();
+	Archetype.Speed = DefaultEnemy->GetCharacterMovement()->MaxWalkSpeed;
+	return Archetypes.Num() - 1;
+}
+
+// --- AddEntity ---
+void UAEOA_EnemyCrowdSubsystem::AddEntity(int32 ArchetypeIndex, const FVector& Location, float Yaw, float Health, AActor* Target)
+{
+	FAEOA_CrowdArchetype& Archetype = Archetypes[ArchetypeIndex];
+	Archetype.Positions.Add(Location);
+	Archetype.Velocities.Add(FVector::ZeroVector);
+	Archetype.Yaws.Add(Yaw);
+	Archetype.Healths.Add(Health);
+	Archetype.Targets.Add(Target);
+	Archetype.Instances->AddInstance(Archetype.MeshOffset * FTransform(FRotator(0.f, Yaw, 0.f), Location), true);
+}
+
+// --- RemoveEntity ---
+// The instanced mesh removes with a swap too, so entity and instance indices stay aligned.
+void UAEOA_EnemyCrowdSubsystem::RemoveEntity(int32 ArchetypeIndex, int32 EntityIndex)
+{
+	FAEOA_CrowdArchetype& Archetype = Archetypes[ArchetypeIndex];
+	Archetype.Positions.RemoveAtSwap(EntityIndex, 1, EAllowShrinking::No);
+	Archetype.Velocities.RemoveAtSwap(EntityIndex, 1, EAllowShrinking::No);
+	Archetype.Yaws.RemoveAtSwap(EntityIndex, 1, EAllowShrinking::No);
+	Archetype.Healths.RemoveAtSwap(EntityIndex, 1, EAllowShrinking::No);
+	Archetype.Targets.RemoveAtSwap(EntityIndex, 1, EAllowShrinking::No);
+	Archetype.Instances->RemoveInstance(EntityIndex);
+}
+
+// --- Tick ---
+void UAEOA_EnemyCrowdSubsystem::Tick(float DeltaTime)
+{
+	SimulateEntities(DeltaTime);
+
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate >= CVarCrowdUpdateInterval.GetValueOnGameThread())
+	{
+		TimeSinceUpdate = 0.f;
+		UpdatePromotions();
+	}
+
+	SET_DWORD_STAT(STAT_AEOA_CrowdEntities, GetNumEntities());
+	SET_DWORD_STAT(STAT_AEOA_CrowdPromoted, TrackedEnemies.Num());
+}
+
+// --- SimulateEntities ---
+// Entities walk straight toward their target on the XY plane; the crowd is only visible from afar,
+// where this is indistinguishable from pathfinding, and promotion hands them to the navigation-aware actor.
+void UAEOA_EnemyCrowdSubsystem::SimulateEntities(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_CrowdSimulation);
+
+	const float AcceptanceRadiusSquared = FMath::Square(CVarCrowdAcceptanceRadius.GetValueOnGameThread());
+
+	for (FAEOA_CrowdArchetype& Archetype : Archetypes)
+	{
+		const int32 NumEntities = Archetype.Positions.Num();
+		if (NumEntities == 0) continue;
+
+		bool bAnyMoved = false;
+		for (int32 Index = 0; Index < NumEntities; ++Index)
+		{
+			FVector Velocity = FVector::ZeroVector;
+			if (const AActor* Target = Archetype.Targets[Index].Get())
+			{
+				const FVector ToTarget = Target->GetActorLocation() - Archetype.Positions[Index];
+				if (ToTarget.SizeSquared2D() > AcceptanceRadiusSquared)
+				{
+					Velocity = ToTarget.GetSafeNormal2D() * Archetype.Speed;
+					Archetype.Yaws[Index] = Velocity.Rotation().Yaw;
+				}
+			}
+			Archetype.Velocities[Index] = Velocity;
+			if (!Velocity.IsZero())
+			{
+				Archetype.Positions[Index] += Velocity * DeltaTime;
+				bAnyMoved = true;
+			}
+		}
+		if (!bAnyMoved) continue;
+
+		Archetype.InstanceTransforms.SetNum(NumEntities, EAllowShrinking::No);
+		for (int32 Index = 0; Index < NumEntities; ++Index)
+		{
+			Archetype.InstanceTransforms[Index] = Archetype.MeshOffset * FTransform(FRotator(0.f, Archetype.Yaws[Index], 0.f), Archetype.Positions[Index]);
+		}
+		Archetype.Instances->BatchUpdateInstancesTransforms(0, Archetype.InstanceTransforms, true, true, true);
+	}
+}
+
+// --- UpdatePromotions ---
+// Promotion and demotion radii differ so an enemy at the boundary does not swap back and forth.
+void UAEOA_EnemyCrowdSubsystem::UpdatePromotions()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_CrowdPromotions);
+
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (!Player) return;
+
+	const FVector PlayerLocation = Player->GetActorLocation();
+	const float PromoteRadiusSquared = FMath::Square(CVarCrowdPromoteRadius.GetValueOnGameThread());
+	const float DemoteRadiusSquared = FMath::Square(FMath::Max(CVarCrowdDemoteRadius.GetValueOnGameThread(), CVarCrowdPromoteRadius.GetValueOnGameThread()));
+	int32 Budget = FMath::Max(1, CVarCrowdMaxSwapsPerUpdate.GetValueOnGameThread());
+
+	for (int32 Index = TrackedEnemies.Num() - 1; Index >= 0 && Budget > 0; --Index)
+	{
+		AAEOA_Enemy* Enemy = TrackedEnemies[Index];
+		if (!IsValid(Enemy) || !Enemy->IsAlive())
+		{
+			// Dead enemies stay actors until their corpse is recycled by the enemy pool.
+			TrackedEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			TrackedTargets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+		if (!Enemy->GetCombatTarget() && FVector::DistSquared(PlayerLocation, Enemy->GetActorLocation()) > DemoteRadiusSquared)
+		{
+			AActor* Target = TrackedTargets[Index].Get();
+			TrackedEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			TrackedTargets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			DemoteEnemy(Enemy, Target);
+			--Budget;
+		}
+	}
+
+	for (int32 ArchetypeIndex = 0; ArchetypeIndex < Archetypes.Num() && Budget > 0; ++ArchetypeIndex)
+	{
+		const FAEOA_CrowdArchetype& Archetype = Archetypes[ArchetypeIndex];
+		for (int32 Index = Archetype.Positions.Num() - 1; Index >= 0 && Budget > 0; --Index)
+		{
+			if (FVector::DistSquared(PlayerLocation, Archetype.Positions[Index]) <= PromoteRadiusSquared)
+			{
+				PromoteEntity(ArchetypeIndex, Index);
+				--Budget;
+			}
+		}
+	}
+}
+
+// --- PromoteEntity ---
+void UAEOA_EnemyCrowdSubsystem::PromoteEntity(int32 ArchetypeIndex, int32 EntityIndex)
+{
+	FAEOA_CrowdArchetype& Archetype = Archetypes[ArchetypeIndex];
+	const FVector Location = Archetype.Positions[EntityIndex];
+	const FRotator Rotation(0.f, Archetype.Yaws[EntityIndex], 0.f);
+
+	AAEOA_Enemy* Enemy = nullptr;
+	if (UAEOA_EnemyPoolSubsystem* EnemyPool = GetWorld()->GetSubsystem<UAEOA_EnemyPoolSubsystem>())
+	{
+		Enemy = EnemyPool->AcquireEnemy(Archetype.EnemyClass, Location, Rotation);
+	}
+	if (!Enemy) return;
+
+	// The enemy registered itself when it was acquired; its entity's target is kept for the next demotion.
+	Enemy->ApplyCrowdState(Archetype.Healths[EntityIndex]);
+	const int32 TrackedIndex = TrackedEnemies.IndexOfByKey(Enemy);
+	if (TrackedIndex != INDEX_NONE)
+	{
+		TrackedTargets[TrackedIndex] = Archetype.Targets[EntityIndex];
+	}
+	RemoveEntity(ArchetypeIndex, EntityIndex);
+}
+
+// --- DemoteEnemy ---
+void UAEOA_EnemyCrowdSubsystem::DemoteEnemy(AAEOA_Enemy* Enemy, AActor* Target)
+{
+	const int32 ArchetypeIndex = FindOrAddArchetype(Enemy->GetClass());
+	if (ArchetypeIndex == INDEX_NONE) return;
+
+	const UAEOA_AttributeComponent* Attributes = Enemy->GetAttributes();
+	AddEntity(ArchetypeIndex, Enemy->GetActorLocation(), Enemy->GetActorRotation().Yaw, Attributes ? Attributes->GetHealth() : 0.f, Target);
+
+	if (UAEOA_EnemyPoolSubsystem* EnemyPool = GetWorld()->GetSubsystem<UAEOA_EnemyPoolSubsystem>())
+	{
+		EnemyPool->ReleaseEnemy(Enemy);
+	}
+	else
+	{
+		Enemy->Destroy();
+	}
+}
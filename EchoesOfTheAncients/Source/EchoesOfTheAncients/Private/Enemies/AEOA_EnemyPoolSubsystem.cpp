@@ -0,0 +1,150 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_EnemyPoolSubsystem class, recycling enemies
+// per class and tracking pool hit and miss rates.
+
+#include "Enemies/AEOA_EnemyPoolSubsystem.h"
+#include "Enemies/AEOA_Enemy.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "EchoesOfTheAncients/EchoesOfTheAncients.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Pool Spawn"), STAT_AEOA_EnemyPoolSpawn, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemy Pool Hits"), STAT_AEOA_EnemyPoolHits, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemy Pool Misses"), STAT_AEOA_EnemyPoolMisses, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemies Pooled"), STAT_AEOA_EnemiesPooled, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<int32> CVarEnemyPoolMaxReserve(
+	TEXT("AEOA.EnemyPool.MaxReservePerClass"),
+	16,
+	TEXT("Upper bound on the number of enemies pre-warmed per class at level load."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorld GDumpEnemyPoolCommand(
+	TEXT("AEOA.EnemyPool.Dump"),
+	TEXT("Logs the size and hit rate of every enemy pool in the current world."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UAEOA_EnemyPoolSubsystem* PoolSubsystem = World ? World->GetSubsystem<UAEOA_EnemyPoolSubsystem>() : nullptr)
+		{
+			PoolSubsystem->DumpStats();
+		}
+	}));
+
+// --- DoesSupportWorldType ---
+bool UAEOA_EnemyPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_EnemyPoolSubsystem::Deinitialize()
+{
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- ReserveEnemies ---
+// Spawns the dormant instances right away so no enemy has to be constructed mid-wave.
+void UAEOA_EnemyPoolSubsystem::ReserveEnemies(TSubclassOf<AAEOA_Enemy> EnemyClass, int32 Count)
+{
+	if (!EnemyClass || Count <= 0) return;
+
+	FAEOA_EnemyPool& Pool = Pools.FindOrAdd(EnemyClass);
+	const int32 MaxReserve = CVarEnemyPoolMaxReserve.GetValueOnGameThread();
+	const int32 NewReserved = FMath::Min(Pool.Reserved + Count, MaxReserve);
+	const int32 ToSpawn = NewReserved - Pool.Reserved;
+	Pool.Reserved = NewReserved;
+
+	for (int32 Index = 0; Index < ToSpawn; ++Index)
+	{
+		if (AAEOA_Enemy* Enemy = SpawnPooledEnemy(EnemyClass))
+		{
+			Pool.Available.Add(Enemy);
+			INC_DWORD_STAT(STAT_AEOA_EnemiesPooled);
+		}
+	}
+}
+
+// --- AcquireEnemy ---
+// Wakes a pooled instance at the requested transform, or spawns one on a miss.
+AAEOA_Enemy* UAEOA_EnemyPoolSubsystem::AcquireEnemy(TSubclassOf<AAEOA_Enemy> EnemyClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (!EnemyClass) return nullptr;
+
+	FAEOA_EnemyPool& Pool = Pools.FindOrAdd(EnemyClass);
+
+	AAEOA_Enemy* Enemy = nullptr;
+	while (!Enemy && Pool.Available.Num() > 0)
+	{
+		Enemy = Pool.Available.Pop(EAllowShrinking::No);
+		if (!IsValid(Enemy))
+		{
+			Enemy = nullptr;
+			continue;
+		}
+		DEC_DWORD_STAT(STAT_AEOA_EnemiesPooled);
+	}
+
+	if (Enemy)
+	{
+		++Pool.Hits;
+		INC_DWORD_STAT(STAT_AEOA_EnemyPoolHits);
+	}
+	else
+	{
+		++Pool.Misses;
+		INC_DWORD_STAT(STAT_AEOA_EnemyPoolMisses);
+		Enemy = SpawnPooledEnemy(EnemyClass);
+		if (!Enemy) return nullptr;
+	}
+
+	Enemy->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+	Enemy->OnAcquiredFromPool();
+	return Enemy;
+}
+
+// --- ReleaseEnemy ---
+void UAEOA_EnemyPoolSubsystem::ReleaseEnemy(AAEOA_Enemy* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+
+	Enemy->OnReleasedToPool();
+	Pools.FindOrAdd(Enemy->GetClass()).Available.Add(Enemy);
+	INC_DWORD_STAT(STAT_AEOA_EnemiesPooled);
+}
+
+// --- DumpStats ---
+void UAEOA_EnemyPoolSubsystem::DumpStats() const
+{
+	UE_LOG(LogEchoesOfTheAncients, Log, TEXT("Enemy pools (%d classes):"), Pools.Num());
+	for (const TPair<UClass*, FAEOA_EnemyPool>& Pair : Pools)
+	{
+		const FAEOA_EnemyPool& Pool = Pair.Value;
+		const int32 Requests = Pool.Hits + Pool.Misses;
+		const float HitRate = Requests > 0 ? 100.f * Pool.Hits / Requests : 0.f;
+		UE_LOG(LogEchoesOfTheAncients, Log, TEXT("  %s: available %d, reserved %d, spawned %d, hits %d, misses %d, hit rate %.1f%%"),
+			*GetNameSafe(Pair.Key), Pool.Available.Num(), Pool.Reserved, Pool.Spawned, Pool.Hits, Pool.Misses, HitRate);
+	}
+}
+
+// --- SpawnPooledEnemy ---
+// The enemy begins play like any other (its AI controller is spawned and kept), then goes dormant right away.
+AAEOA_Enemy* UAEOA_EnemyPoolSubsystem::SpawnPooledEnemy(UClass* EnemyClass)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_EnemyPoolSpawn);
+
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AAEOA_Enemy* Enemy = World->SpawnActor<AAEOA_Enemy>(EnemyClass, FTransform::Identity, SpawnParams);
+	if (!Enemy) return nullptr;
+
+	Enemy->OnReleasedToPool();
+
+	++Pools.FindOrAdd(EnemyClass).Spawned;
+	return Enemy;
+}
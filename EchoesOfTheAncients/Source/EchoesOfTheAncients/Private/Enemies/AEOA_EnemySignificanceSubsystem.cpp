@@ -0,0 +1,213 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_EnemySignificanceSubsystem class, assigning
+// enemy significance tiers and throttling enemy ticks per tier.
+
+#include "Enemies/AEOA_EnemySignificanceSubsystem.h"
+#include "Enemies/AEOA_Enemy.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_CYCLE_STAT(TEXT("Significance Evaluation"), STAT_AEOA_SignificanceEvaluation, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemies Engaged"), STAT_AEOA_EnemiesEngaged, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemies Nearby"), STAT_AEOA_EnemiesNearby, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemies Distant"), STAT_AEOA_EnemiesDistant, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemies Culled"), STAT_AEOA_EnemiesCulled, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Engaged Tier Ticks/s"), STAT_AEOA_EngagedTicksPerSecond, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Nearby Tier Ticks/s"), STAT_AEOA_NearbyTicksPerSecond, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Distant Tier Ticks/s"), STAT_AEOA_DistantTicksPerSecond, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Culled Tier Ticks/s"), STAT_AEOA_CulledTicksPerSecond, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarSignificanceUpdateInterval(
+	TEXT("AEOA.Significance.UpdateInterval"),
+	0.25f,
+	TEXT("Seconds between two evaluations of the enemy significance tiers."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSignificanceNearbyRadius(
+	TEXT("AEOA.Significance.NearbyRadius"),
+	2000.f,
+	TEXT("Enemies closer to Aria than this distance are Nearby and tick at full rate, in Unreal units."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSignificanceDistantRadius(
+	TEXT("AEOA.Significance.DistantRadius"),
+	6000.f,
+	TEXT("Rendered enemies closer than this distance are Distant; farther or unseen enemies are Culled, in Unreal units."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSignificanceDistantTickInterval(
+	TEXT("AEOA.Significance.DistantTickInterval"),
+	0.1f,
+	TEXT("Tick interval of the actor, movement and components of Distant enemies, in seconds."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSignificanceCulledTickInterval(
+	TEXT("AEOA.Significance.CulledTickInterval"),
+	0.5f,
+	TEXT("Tick interval of the actor, movement and components of Culled enemies, in seconds."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_EnemySignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_EnemySignificanceSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	Tiers.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_EnemySignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_EnemySignificanceSubsystem, STATGROUP_Tickables);
+}
+
+// --- RegisterEnemy ---
+void UAEOA_EnemySignificanceSubsystem::RegisterEnemy(AAEOA_Enemy* Enemy)
+{
+	if (!Enemy || Enemies.Contains(Enemy)) return;
+
+	Enemies.Add(Enemy);
+	Tiers.Add(EAEOA_EnemySignificance::EES_Engaged);
+}
+
+// --- UnregisterEnemy ---
+void UAEOA_EnemySignificanceSubsystem::UnregisterEnemy(AAEOA_Enemy* Enemy)
+{
+	const int32 Index = Enemies.Find(Enemy);
+	if (Index == INDEX_NONE) return;
+
+	if (Tiers[Index] != EAEOA_EnemySignificance::EES_Engaged)
+	{
+		ApplyTier(Enemy, EAEOA_EnemySignificance::EES_Engaged);
+	}
+	Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Tiers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// --- GetSignificance ---
+EAEOA_EnemySignificance UAEOA_EnemySignificanceSubsystem::GetSignificance(const AAEOA_Enemy* Enemy) const
+{
+	const int32 Index = Enemies.IndexOfByKey(Enemy);
+	return Index != INDEX_NONE ? Tiers[Index] : EAEOA_EnemySignificance::EES_Engaged;
+}
+
+// --- GetTierTickInterval ---
+float UAEOA_EnemySignificanceSubsystem::GetTierTickInterval(EAEOA_EnemySignificance Tier)
+{
+	switch (Tier)
+	{
+	case EAEOA_EnemySignificance::EES_Distant:
+		return FMath::Max(0.f, CVarSignificanceDistantTickInterval.GetValueOnGameThread());
+	case EAEOA_EnemySignificance::EES_Culled:
+		return FMath::Max(0.f, CVarSignificanceCulledTickInterval.GetValueOnGameThread());
+	default:
+		return 0.f;
+	}
+}
+
+// --- Tick ---
+void UAEOA_EnemySignificanceSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate >= CVarSignificanceUpdateInterval.GetValueOnGameThread())
+	{
+		TimeSinceUpdate = 0.f;
+		EvaluateTiers();
+	}
+
+	// Counters reset every frame, so the tier stats are published every frame from the last evaluation.
+	int32 TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_MAX)] = {};
+	for (const EAEOA_EnemySignificance Tier : Tiers)
+	{
+		++TierCounts[static_cast<int32>(Tier)];
+	}
+
+	// Scheduled ticks per second of each tier, the frame-rate independent cost the thresholds trade against.
+	const float FrameRate = DeltaTime > 0.f ? 1.f / DeltaTime : 0.f;
+	auto TicksPerSecond = [FrameRate](EAEOA_EnemySignificance Tier, int32 Count)
+	{
+		const float Interval = GetTierTickInterval(Tier);
+		return Count * (Interval > 0.f ? FMath::Min(FrameRate, 1.f / Interval) : FrameRate);
+	};
+
+	SET_DWORD_STAT(STAT_AEOA_EnemiesEngaged, TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_Engaged)]);
+	SET_DWORD_STAT(STAT_AEOA_EnemiesNearby, TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_Nearby)]);
+	SET_DWORD_STAT(STAT_AEOA_EnemiesDistant, TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_Distant)]);
+	SET_DWORD_STAT(STAT_AEOA_EnemiesCulled, TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_Culled)]);
+	SET_FLOAT_STAT(STAT_AEOA_EngagedTicksPerSecond, TicksPerSecond(EAEOA_EnemySignificance::EES_Engaged, TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_Engaged)]));
+	SET_FLOAT_STAT(STAT_AEOA_NearbyTicksPerSecond, TicksPerSecond(EAEOA_EnemySignificance::EES_Nearby, TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_Nearby)]));
+	SET_FLOAT_STAT(STAT_AEOA_DistantTicksPerSecond, TicksPerSecond(EAEOA_EnemySignificance::EES_Distant, TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_Distant)]));
+	SET_FLOAT_STAT(STAT_AEOA_CulledTicksPerSecond, TicksPerSecond(EAEOA_EnemySignificance::EES_Culled, TierCounts[static_cast<int32>(EAEOA_EnemySignificance::EES_Culled)]));
+}
+
+// --- EvaluateTiers ---
+// Squared distances to Aria and the mesh's last render time are enough to rank every enemy in one pass;
+// tick intervals are only touched for enemies that changed tier.
+void UAEOA_EnemySignificanceSubsystem::EvaluateTiers()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_SignificanceEvaluation);
+
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (!Player) return;
+
+	const FVector PlayerLocation = Player->GetActorLocation();
+	const float NearbyRadiusSquared = FMath::Square(CVarSignificanceNearbyRadius.GetValueOnGameThread());
+	const float DistantRadiusSquared = FMath::Square(CVarSignificanceDistantRadius.GetValueOnGameThread());
+
+	for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+	{
+		AAEOA_Enemy* Enemy = Enemies[Index];
+		if (!IsValid(Enemy)) continue;
+
+		const float DistanceSquared = FVector::DistSquared(PlayerLocation, Enemy->GetActorLocation());
+
+		EAEOA_EnemySignificance Tier = EAEOA_EnemySignificance::EES_Culled;
+		if (Enemy->GetCombatTarget())
+		{
+			Tier = EAEOA_EnemySignificance::EES_Engaged;
+		}
+		else if (DistanceSquared <= NearbyRadiusSquared)
+		{
+			Tier = EAEOA_EnemySignificance::EES_Nearby;
+		}
+		else if (DistanceSquared <= DistantRadiusSquared && Enemy->GetMesh()->WasRecentlyRendered(0.5f))
+		{
+			Tier = EAEOA_EnemySignificance::EES_Distant;
+		}
+
+		if (Tier != Tiers[Index])
+		{
+			Tiers[Index] = Tier;
+			ApplyTier(Enemy, Tier);
+		}
+	}
+}
+
+// --- ApplyTier ---
+void UAEOA_EnemySignificanceSubsystem::ApplyTier(AAEOA_Enemy* Enemy, EAEOA_EnemySignificance Tier)
+{
+	const float Interval = GetTierTickInterval(Tier);
+
+	// The think scheduler reads the tier from the enemy to order and space its think steps.
+	Enemy->SetSignificance(Tier);
+	Enemy->SetActorTickInterval(Interval);
+
+	// Covers the character movement, the skeletal mesh and every other ticking component.
+	Enemy->ForEachComponent(false, [Interval](UActorComponent* Component)
+	{
+		if (Component->PrimaryComponentTick.bCanEverTick)
+		{
+			Component->SetComponentTickInterval(Interval);
+		}
+	});
+}
@@ -0,0 +1,53 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the AAEOA_EnemySpawnPoint class, activating pooled
+// enemies at level-placed spawn points.
+
+#include "Enemies/AEOA_EnemySpawnPoint.h"
+#include "Enemies/AEOA_Enemy.h"
+#include "Enemies/AEOA_EnemyPoolSubsystem.h"
+#include "Components/ArrowComponent.h"
+#include "Components/CapsuleComponent.h"
+
+// --- Constructor ---
+AAEOA_EnemySpawnPoint::AAEOA_EnemySpawnPoint()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	SetRootComponent(CreateDefaultSubobject<USceneComponent>(TEXT("Root")));
+
+#if WITH_EDITORONLY_DATA
+	Arrow = CreateEditorOnlyDefaultSubobject<UArrowComponent>(TEXT("Arrow"));
+	if (Arrow)
+	{
+		Arrow->SetupAttachment(GetRootComponent());
+	}
+#endif
+}
+
+// --- BeginPlay ---
+void AAEOA_EnemySpawnPoint::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UAEOA_EnemyPoolSubsystem* EnemyPool = GetWorld()->GetSubsystem<UAEOA_EnemyPoolSubsystem>())
+	{
+		EnemyPool->ReserveEnemies(EnemyClass, PoolReserve);
+	}
+	if (bSpawnOnBeginPlay)
+	{
+		SpawnEnemy();
+	}
+}
+
+// --- SpawnEnemy ---
+// The point sits on the ground, so the enemy is raised by its capsule half height.
+AAEOA_Enemy* AAEOA_EnemySpawnPoint::SpawnEnemy()
+{
+	UAEOA_EnemyPoolSubsystem* EnemyPool = GetWorld()->GetSubsystem<UAEOA_EnemyPoolSubsystem>();
+	if (!EnemyClass || !EnemyPool) return nullptr;
+
+	const AAEOA_Enemy* DefaultEnemy = EnemyClass->GetDefaultObject<AAEOA_Enemy>();
+	const float HalfHeight = DefaultEnemy->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+
+	return EnemyPool->AcquireEnemy(EnemyClass, GetActorLocation() + FVector(0.f, 0.f, HalfHeight), FRotator(0.f, GetActorRotation().Yaw, 0.f));
+}
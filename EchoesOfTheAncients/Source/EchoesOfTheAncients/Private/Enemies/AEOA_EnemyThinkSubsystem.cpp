@@ -0,0 +1,162 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_EnemyThinkSubsystem class, time-slicing the
+// think steps of enemies under a per-frame budget.
+
+#include "Enemies/AEOA_EnemyThinkSubsystem.h"
+#include "Enemies/AEOA_Enemy.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Think"), STAT_AEOA_EnemyThink, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemy Thinks Per Frame"), STAT_AEOA_EnemyThinksPerFrame, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Enemy Think Avg Delay (ms)"), STAT_AEOA_EnemyThinkAvgDelay, STATGROUP_EchoesOfTheAncients);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Enemy Think Max Delay (ms)"), STAT_AEOA_EnemyThinkMaxDelay, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemy Think Budget Overruns"), STAT_AEOA_EnemyThinkOverruns, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarThinkBudgetMs(
+	TEXT("AEOA.Think.BudgetMs"),
+	1.f,
+	TEXT("Milliseconds per frame the enemy think steps may use; enemies that do not fit wait for the next frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarThinkNearbyInterval(
+	TEXT("AEOA.Think.NearbyInterval"),
+	0.1f,
+	TEXT("Seconds between two think steps of a Nearby enemy. Engaged enemies think every frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarThinkDistantInterval(
+	TEXT("AEOA.Think.DistantInterval"),
+	0.5f,
+	TEXT("Seconds between two think steps of a Distant enemy."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarThinkCulledInterval(
+	TEXT("AEOA.Think.CulledInterval"),
+	2.f,
+	TEXT("Seconds between two think steps of a Culled enemy."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_EnemyThinkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_EnemyThinkSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	LastThinkTimes.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_EnemyThinkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_EnemyThinkSubsystem, STATGROUP_Tickables);
+}
+
+// --- RegisterEnemy ---
+void UAEOA_EnemyThinkSubsystem::RegisterEnemy(AAEOA_Enemy* Enemy)
+{
+	if (!Enemy || Enemies.Contains(Enemy)) return;
+
+	Enemies.Add(Enemy);
+	LastThinkTimes.Add(-UE_BIG_NUMBER);
+}
+
+// --- UnregisterEnemy ---
+// Swap removal moves the last enemy behind some cursors; it thinks one round late at worst.
+void UAEOA_EnemyThinkSubsystem::UnregisterEnemy(AAEOA_Enemy* Enemy)
+{
+	const int32 Index = Enemies.Find(Enemy);
+	if (Index == INDEX_NONE) return;
+
+	Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	LastThinkTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// --- GetTierThinkInterval ---
+float UAEOA_EnemyThinkSubsystem::GetTierThinkInterval(EAEOA_EnemySignificance Tier)
+{
+	switch (Tier)
+	{
+	case EAEOA_EnemySignificance::EES_Nearby:
+		return CVarThinkNearbyInterval.GetValueOnGameThread();
+	case EAEOA_EnemySignificance::EES_Distant:
+		return CVarThinkDistantInterval.GetValueOnGameThread();
+	case EAEOA_EnemySignificance::EES_Culled:
+		return CVarThinkCulledInterval.GetValueOnGameThread();
+	default:
+		return 0.f;
+	}
+}
+
+// --- Tick ---
+void UAEOA_EnemyThinkSubsystem::Tick(float DeltaTime)
+{
+	NumThinks = 0;
+	TotalThinkDelay = 0.0;
+	MaxThinkDelay = 0.0;
+
+	if (Enemies.Num() > 0)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AEOA_EnemyThink);
+
+		const double Now = GetWorld()->GetTimeSeconds();
+		const double BudgetEndTime = FPlatformTime::Seconds() + CVarThinkBudgetMs.GetValueOnGameThread() / 1000.0;
+
+		for (int32 TierIndex = 0; TierIndex < static_cast<int32>(EAEOA_EnemySignificance::EES_MAX); ++TierIndex)
+		{
+			if (!ThinkTier(static_cast<EAEOA_EnemySignificance>(TierIndex), Now, BudgetEndTime))
+			{
+				INC_DWORD_STAT(STAT_AEOA_EnemyThinkOverruns);
+				break;
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AEOA_EnemyThinksPerFrame, NumThinks);
+	SET_FLOAT_STAT(STAT_AEOA_EnemyThinkAvgDelay, NumThinks > 0 ? static_cast<float>(TotalThinkDelay / NumThinks * 1000.0) : 0.f);
+	SET_FLOAT_STAT(STAT_AEOA_EnemyThinkMaxDelay, static_cast<float>(MaxThinkDelay * 1000.0));
+}
+
+// --- ThinkTier ---
+// Each tier keeps its own cursor, so enemies cut off by the budget are first in line on the next frame.
+bool UAEOA_EnemyThinkSubsystem::ThinkTier(EAEOA_EnemySignificance Tier, double Now, double BudgetEndTime)
+{
+	const float Interval = GetTierThinkInterval(Tier);
+	int32& Cursor = TierCursors[static_cast<int32>(Tier)];
+	if (Cursor >= Enemies.Num()) Cursor = 0;
+
+	// Enemies can unregister while thinking (e.g., on death), so the count is re-read every step.
+	for (int32 Step = 0; Step < Enemies.Num(); ++Step)
+	{
+		const int32 Index = (Cursor + Step) % Enemies.Num();
+		AAEOA_Enemy* Enemy = Enemies[Index];
+		if (!IsValid(Enemy) || Enemy->GetSignificance() != Tier) continue;
+
+		const double SinceLastThink = Now - LastThinkTimes[Index];
+		if (SinceLastThink < Interval) continue;
+
+		// The first think of an enemy has no meaningful delay or elapsed time.
+		const bool bFirstThink = LastThinkTimes[Index] < 0.0;
+		const double Delay = bFirstThink ? 0.0 : SinceLastThink - Interval;
+		TotalThinkDelay += Delay;
+		MaxThinkDelay = FMath::Max(MaxThinkDelay, Delay);
+
+		LastThinkTimes[Index] = Now;
+		++NumThinks;
+		Enemy->Think(bFirstThink ? 0.f : static_cast<float>(SinceLastThink));
+
+		if (FPlatformTime::Seconds() >= BudgetEndTime)
+		{
+			Cursor = Enemies.Num() > 0 ? (Index + 1) % Enemies.Num() : 0;
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,198 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the AAEOA_CoinBurst class, simulating and collecting
+// instanced coins without spawning an actor per coin.
+
+#include "Items/AEOA_CoinBurst.h"
+#include "Characters/AriaCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_CYCLE_STAT(TEXT("Coin Burst Tick"), STAT_AEOA_CoinBurstTick, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Burst Coins"), STAT_AEOA_BurstCoins, STATGROUP_EchoesOfTheAncients);
+
+// --- Constructor ---
+AAEOA_CoinBurst::AAEOA_CoinBurst()
+{
+	// Ticks only while coins remain; enabled by Burst.
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	CoinInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("CoinInstances"));
+	SetRootComponent(CoinInstances);
+	CoinInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	CoinInstances->SetGenerateOverlapEvents(false);
+	CoinInstances->SetCastShadow(false);
+	// Collected coins are removed with a swap so instance indices stay in step with the coin arrays.
+	CoinInstances->bSupportRemoveAtSwap = true;
+}
+
+// --- Begin Play ---
+void AAEOA_CoinBurst::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bBurstOnBeginPlay)
+	{
+		Burst();
+	}
+}
+
+// --- End Play ---
+void AAEOA_CoinBurst::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Coins still on the ground when the burst goes away were counted but never collected.
+	DEC_DWORD_STAT_BY(STAT_AEOA_BurstCoins, Positions.Num());
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// --- Burst ---
+// Finds the ground once, then adds every coin at the origin with a random launch velocity.
+void AAEOA_CoinBurst::Burst()
+{
+	UWorld* World = GetWorld();
+	if (!World || NumCoins <= 0) return;
+
+	const FVector Origin = GetActorLocation();
+	FHitResult GroundHit;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AEOA_CoinBurstGround), false, this);
+	GroundZ = World->LineTraceSingleByChannel(GroundHit, Origin, Origin - FVector(0.f, 0.f, 2000.f), ECollisionChannel::ECC_Visibility, QueryParams)
+		? GroundHit.ImpactPoint.Z
+		: Origin.Z;
+	GroundZ += RestHeight;
+
+	const int32 FirstCoin = Positions.Num();
+	Positions.Reserve(FirstCoin + NumCoins);
+	Velocities.Reserve(FirstCoin + NumCoins);
+	Yaws.Reserve(FirstCoin + NumCoins);
+	InstanceTransforms.Reset();
+
+	for (int32 Coin = 0; Coin < NumCoins; ++Coin)
+	{
+		const float Heading = FMath::FRandRange(0.f, UE_TWO_PI);
+		const float Speed = FMath::FRandRange(HorizontalSpeed.X, HorizontalSpeed.Y);
+		const float Yaw = FMath::FRandRange(0.f, 360.f);
+
+		Positions.Add(Origin);
+		Velocities.Add(FVector(FMath::Cos(Heading) * Speed, FMath::Sin(Heading) * Speed, FMath::FRandRange(VerticalSpeed.X, VerticalSpeed.Y)));
+		Yaws.Add(Yaw);
+		InstanceTransforms.Add(FTransform(FRotator(0.f, Yaw, 0.f), Origin));
+	}
+	CoinInstances->AddInstances(InstanceTransforms, false, true);
+
+	NumMoving += NumCoins;
+	BurstTime = World->GetTimeSeconds();
+	INC_DWORD_STAT_BY(STAT_AEOA_BurstCoins, NumCoins);
+	SetActorTickEnabled(true);
+}
+
+// --- Tick ---
+void AAEOA_CoinBurst::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_CoinBurstTick);
+
+	Super::Tick(DeltaTime);
+
+	if (NumMoving > 0 && SimulateCoins(DeltaTime))
+	{
+		InstanceTransforms.SetNumUninitialized(Positions.Num(), EAllowShrinking::No);
+		for (int32 Index = 0; Index < Positions.Num(); ++Index)
+		{
+			InstanceTransforms[Index] = FTransform(FRotator(0.f, Yaws[Index], 0.f), Positions[Index]);
+		}
+		CoinInstances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, true);
+	}
+
+	if (GetWorld()->GetTimeSeconds() - BurstTime >= CollectDelay)
+	{
+		CollectCoins(Cast<AAriaCharacter>(UGameplayStatics::GetPlayerPawn(this, 0)));
+	}
+
+	if (Positions.IsEmpty())
+	{
+		Destroy();
+	}
+}
+
+// --- SimulateCoins ---
+// Explicit Euler integration against a flat ground plane at GroundZ; settled coins keep a zero velocity and are skipped.
+bool AAEOA_CoinBurst::SimulateCoins(float DeltaTime)
+{
+	bool bAnyMoved = false;
+	for (int32 Index = 0; Index < Positions.Num(); ++Index)
+	{
+		FVector& Velocity = Velocities[Index];
+		if (Velocity.IsZero()) continue;
+
+		FVector& Position = Positions[Index];
+		Velocity.Z -= Gravity * DeltaTime;
+		Position += Velocity * DeltaTime;
+		Yaws[Index] = FMath::Fmod(Yaws[Index] + Velocity.Size2D() * 2.f * DeltaTime, 360.f);
+		bAnyMoved = true;
+
+		if (Position.Z <= GroundZ && Velocity.Z < 0.f)
+		{
+			Position.Z = GroundZ;
+			Velocity.Z = -Velocity.Z * Restitution;
+			Velocity.X *= Friction;
+			Velocity.Y *= Friction;
+			if (Velocity.Z < SettleSpeed)
+			{
+				Velocity = FVector::ZeroVector;
+				--NumMoving;
+			}
+		}
+	}
+	return bAnyMoved;
+}
+
+// --- CollectCoins ---
+// Iterates backwards so removing a coin only swaps in coins that were already checked.
+void AAEOA_CoinBurst::CollectCoins(AAriaCharacter* AriaCharacter)
+{
+	if (!AriaCharacter) return;
+
+	const FVector AriaLocation = AriaCharacter->GetActorLocation();
+	const float HalfHeight = AriaCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	const float CollectRadiusSquared = CollectRadius * CollectRadius;
+
+	int32 NumCollected = 0;
+	for (int32 Index = Positions.Num() - 1; Index >= 0; --Index)
+	{
+		const FVector ToCoin = Positions[Index] - AriaLocation;
+		if (FMath::Abs(ToCoin.Z) > HalfHeight || ToCoin.SizeSquared2D() > CollectRadiusSquared) continue;
+
+		RemoveCoin(Index);
+		++NumCollected;
+	}
+	if (NumCollected == 0) return;
+
+	// One sound per frame, however many coins were scooped up together.
+	if (PickupSound)
+	{
+		UGameplayStatics::PlaySoundAtLocation(this, PickupSound, AriaLocation);
+	}
+	if (IsDawnspire)
+	{
+		for (int32 Coin = 0; Coin < NumCollected; ++Coin)
+		{
+			AriaCharacter->IncrementDawnspireCount();
+		}
+	}
+}
+
+// --- RemoveCoin ---
+void AAEOA_CoinBurst::RemoveCoin(int32 Index)
+{
+	if (!Velocities[Index].IsZero())
+	{
+		--NumMoving;
+	}
+	Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Yaws.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	CoinInstances->RemoveInstance(Index);
+	DEC_DWORD_STAT(STAT_AEOA_BurstCoins);
+}
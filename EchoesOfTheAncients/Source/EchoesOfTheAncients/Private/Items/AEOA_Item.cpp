@@ -2,107 +2,151 @@
 
 
 #include "Items/AEOA_Item.h"
-#include "Characters/AriaCharacter.h"
 #include "Components/SphereComponent.h"
 #include "EchoesOfTheAncients/DebugMacros.h"
+#include "Items/AEOA_ItemEffectSubsystem.h"
+#include "Items/AEOA_ItemHoverSubsystem.h"
+#include "Items/AEOA_PickupGridSubsystem.h"
 #include "Math/UnrealMathUtility.h"
 #include "NiagaraComponent.h"
 
 // --- Constructor ---
 AAEOA_Item::AAEOA_Item()
 {
-	// Enable ticking for this actor
-	PrimaryActorTick.bCanEverTick = true;
+	// Items never tick; the hover motion is driven by UAEOA_ItemHoverSubsystem.
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Create and initialize the static mesh component as a default subobject
 	ItemMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("ItemMeshComponent"));
 	// Set ItemMesh as the root component, replacing the default scene root
 	RootComponent = ItemMesh;
 
-	// Create a sphere component for overlap detection and attach it to the root component.
+	// Create a sphere component defining the pickup radius and attach it to the root component.
+	// Pickup detection is a query against UAEOA_PickupGridSubsystem, so the sphere needs no collision.
 	Sphere = CreateDefaultSubobject<USphereComponent>(TEXT("Sphere"));
 	Sphere->SetupAttachment(GetRootComponent());
+	Sphere->SetGenerateOverlapEvents(false);
+	Sphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
 	SpectralxAIEffect = CreateDefaultSubobject<UNiagaraComponent>(TEXT("SpectralxAIEffect"));
 	SpectralxAIEffect->SetupAttachment(GetRootComponent());
+	// The effect is simulated by a pooled component from UAEOA_ItemEffectSubsystem while the item is significant.
+	SpectralxAIEffect->SetAutoActivate(false);
 }
 
 // --- Begin Play ---
 void AAEOA_Item::BeginPlay()
 {
 	Super::BeginPlay();
-	
-	// Bind the OnSphereOverlap callback to the OnComponentBeginOverlap delegate on the Sphere component.
-	// This ensures that OnSphereOverlap is called whenever another actor overlaps with the Sphere.
-	Sphere->OnComponentBeginOverlap.AddDynamic(this, &AAEOA_Item::OnSphereOverlap);
-
-	// Bind the OnSphereEndOverlap function to the OnComponentEndOverlap delegate on the Sphere component.
-	// AddDynamic allows runtime binding of the callback to handle the end of an overlap event.
-	Sphere->OnComponentEndOverlap.AddDynamic(this, &AAEOA_Item::OnSphereEndOverlap);
+
+	// Hand the bobbing, rotation, SpectralxAI effect and pickup detection over to the item subsystems.
+	if (ItemState == EItemState::EIS_Hovering)
+	{
+		RegisterWithItemSubsystems();
+	}
 }
 
-// --- Transformed Functions ---
-// Computes a sine wave value for vertical bobbing motion based on RunningTime and TimeConstant.
-float AAEOA_Item::TransformedSin()
+// --- End Play ---
+void AAEOA_Item::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	return Amplitude * FMath::Sin(RunningTime * TimeConstant);  // Compute transformed sine
+	UnregisterFromItemSubsystems();
+
+	Super::EndPlay(EndPlayReason);
 }
 
-// Computes a cosine wave value for potential horizontal motion based on RunningTime and TimeConstant.
-float AAEOA_Item::TransformedCos()
+// --- SetItemState ---
+// Switches the item state and starts or stops the hover animation and effect accordingly.
+void AAEOA_Item::SetItemState(EItemState NewState)
+{
+	if (ItemState == NewState) return;
+	ItemState = NewState;
+
+	// Before BeginPlay the state is only recorded; BeginPlay registers hovering items.
+	if (!HasActorBegunPlay()) return;
+
+	if (ItemState == EItemState::EIS_Hovering)
+	{
+		RegisterWithItemSubsystems();
+	}
+	else
+	{
+		UnregisterFromItemSubsystems();
+	}
+}
+
+// --- Pool Hooks ---
+// Wakes a pooled item: the hover origin is captured from the transform set by the pool before this call.
+void AAEOA_Item::OnAcquiredFromPool()
+{
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetItemState(EItemState::EIS_Hovering);
+}
+
+// Parks the item: it stops hovering and can no longer be seen or overlapped.
+void AAEOA_Item::OnReleasedToPool()
 {
-	return Amplitude * FMath::Cos(RunningTime * TimeConstant);  // Compute transformed cosine
+	SetItemState(EItemState::EIS_Pooled);
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
 }
 
-// --- Overlap Begin Callback ---
-// Callback function triggered when the Sphere component overlaps with another actor.
-void AAEOA_Item::OnSphereOverlap(
-	UPrimitiveComponent* OverlappedComponent,   // The component on this actor that was overlapped (Sphere)
-	AActor* OtherActor,                         // The actor that overlapped with this component (e.g., player)
-	UPrimitiveComponent* OtherComp,             // The component on the other actor (e.g., player's capsule)
-	int32 OtherBodyIndex,                       // Index of the physics body on the other actor (if applicable)
-	bool bFromSweep,                            // True if the overlap resulted from a sweep (movement check)
-	const FHitResult& SweepResult               // Details about the overlap point if bFromSweep is true
-	)
+// --- RegisterWithItemSubsystems ---
+void AAEOA_Item::RegisterWithItemSubsystems()
 {
-	//// Cast the overlapping actor to AAriaCharacter (Aria) to set the overlapping item.
-	AAriaCharacter* AriaCharacter = Cast<AAriaCharacter>(OtherActor);
-	if (AriaCharacter)
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	if (UAEOA_ItemHoverSubsystem* HoverSubsystem = World->GetSubsystem<UAEOA_ItemHoverSubsystem>())
+	{
+		HoverSubsystem->RegisterItem(this);
+	}
+	if (UAEOA_ItemEffectSubsystem* EffectSubsystem = World->GetSubsystem<UAEOA_ItemEffectSubsystem>())
 	{
-		AriaCharacter->SetOverlappingItem(this); // Set this item as the overlapping item on Aria.
+		EffectSubsystem->RegisterItem(this);
+	}
+	if (UAEOA_PickupGridSubsystem* GridSubsystem = World->GetSubsystem<UAEOA_PickupGridSubsystem>())
+	{
+		GridSubsystem->RegisterItem(this);
 	}
 }
 
-// --- Overlap End Callback ---
-// Triggered when the Sphere component stops overlapping with another actor, printing a message with the actor's name in blue.
-void AAEOA_Item::OnSphereEndOverlap(
-	UPrimitiveComponent* OverlappedComponent,   // The Sphere component on this actor that stopped overlapping
-	AActor* OtherActor,                         // The actor that stopped overlapping (e.g., player)
-	UPrimitiveComponent* OtherComp,             // The component on the other actor (e.g., player's capsule)
-	int32 OtherBodyIndex                        // Index of the physics body on the other actor (if applicable)
-	)
+// --- UnregisterFromItemSubsystems ---
+void AAEOA_Item::UnregisterFromItemSubsystems()
 {
-	// Cast the overlapping actor to AAriaCharacter (Aria) to clear the overlapping item.
-	AAriaCharacter* AriaCharacter = Cast<AAriaCharacter>(OtherActor);
-	if (AriaCharacter)
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	if (UAEOA_ItemHoverSubsystem* HoverSubsystem = World->GetSubsystem<UAEOA_ItemHoverSubsystem>())
 	{
-		AriaCharacter->SetOverlappingItem(nullptr);  // Clear the overlapping item when Aria stops overlapping.
+		HoverSubsystem->UnregisterItem(this);
+	}
+	if (UAEOA_ItemEffectSubsystem* EffectSubsystem = World->GetSubsystem<UAEOA_ItemEffectSubsystem>())
+	{
+		EffectSubsystem->UnregisterItem(this);
+	}
+	if (UAEOA_PickupGridSubsystem* GridSubsystem = World->GetSubsystem<UAEOA_PickupGridSubsystem>())
+	{
+		GridSubsystem->UnregisterItem(this);
 	}
 }
 
-void AAEOA_Item::Tick(float DeltaTime)
+// --- Transformed Functions ---
+// Computes a sine wave value for vertical bobbing motion based on the item’s lifetime and TimeConstant.
+float AAEOA_Item::TransformedSin()
 {
-	Super::Tick(DeltaTime);
+	return Amplitude * FMath::Sin(GetGameTimeSinceCreation() * TimeConstant);  // Compute transformed sine
+}
 
-	// Increment RunningTime to drive sine-based bobbing and rotation effects over time.
-	RunningTime += DeltaTime;
+// Computes a cosine wave value for potential horizontal motion based on the item’s lifetime and TimeConstant.
+float AAEOA_Item::TransformedCos()
+{
+	return Amplitude * FMath::Cos(GetGameTimeSinceCreation() * TimeConstant);  // Compute transformed cosine
+}
 
-	// Apply vertical bobbing motion to the Z-axis using the transformed sine value, only if the item is in the hovering state.
-	if (ItemState == EItemState::EIS_Hovering)
-	{
-		// Apply vertical bobbing motion to the Z-axis using the transformed sine value.
-		AddActorWorldOffset(FVector(0.f, 0.f, TransformedSin()));
-		// Apply rotation around the Y-axis, scaled by DeltaTime for frame-rate independence.
-		AddActorWorldRotation(FRotator(0.f, RotationRate * DeltaTime, 0.f));
-	}
-}
\ No newline at end of file
+// --- Pickup Proximity ---
+// Items are picked up explicitly by default, so the contact is left to Aria's PickupItem.
+bool AAEOA_Item::HandlePickupProximity(AAriaCharacter* AriaCharacter)
+{
+	return false;
+}
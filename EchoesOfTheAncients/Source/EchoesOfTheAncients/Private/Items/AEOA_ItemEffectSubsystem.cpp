@@ -0,0 +1,224 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_ItemEffectSubsystem class, ranking items by
+// significance and pooling the SpectralxAI effects of insignificant ones.
+
+#include "Items/AEOA_ItemEffectSubsystem.h"
+#include "Items/AEOA_Item.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "NiagaraComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Item Effect Significance"), STAT_AEOA_ItemEffectSignificance, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Item Effects Active"), STAT_AEOA_ItemEffectsActive, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Item Effects Pooled"), STAT_AEOA_ItemEffectsPooled, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<int32> CVarItemEffectBudget(
+	TEXT("AEOA.ItemFX.Budget"),
+	12,
+	TEXT("Maximum number of item SpectralxAI effects simulating at once."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarItemEffectMaxDistance(
+	TEXT("AEOA.ItemFX.MaxDistance"),
+	5000.f,
+	TEXT("Distance from the viewer beyond which an item effect is never significant (Unreal units)."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarItemEffectBehindWeight(
+	TEXT("AEOA.ItemFX.BehindWeight"),
+	3.f,
+	TEXT("How strongly items outside the view direction are penalized. 0 ranks by distance only."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemEffectUpdateInterval(
+	TEXT("AEOA.ItemFX.UpdateInterval"),
+	0.2f,
+	TEXT("Seconds between item effect significance evaluations."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_ItemEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_ItemEffectSubsystem::Deinitialize()
+{
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		if (Items[Index])
+		{
+			Items[Index]->EffectIndex = INDEX_NONE;
+		}
+		if (Effects[Index])
+		{
+			Effects[Index]->DestroyComponent();
+		}
+	}
+	for (UNiagaraComponent* Effect : Pool)
+	{
+		if (Effect)
+		{
+			Effect->DestroyComponent();
+		}
+	}
+	Items.Empty();
+	Effects.Empty();
+	Pool.Empty();
+	NumActiveEffects = 0;
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_ItemEffectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_ItemEffectSubsystem, STATGROUP_Tickables);
+}
+
+// --- RegisterItem ---
+// Registers the item; its effect is granted on the next significance evaluation.
+void UAEOA_ItemEffectSubsystem::RegisterItem(AAEOA_Item* Item)
+{
+	if (!Item || Item->EffectIndex != INDEX_NONE) return;
+	if (!Item->SpectralxAIEffect || !Item->SpectralxAIEffect->GetAsset()) return;
+
+	Item->EffectIndex = Items.Add(Item);
+	Effects.Add(nullptr);
+
+	// Evaluate on the next tick so a newly spawned item does not wait a full interval for its glow.
+	TimeSinceUpdate = CVarItemEffectUpdateInterval.GetValueOnGameThread();
+}
+
+// --- UnregisterItem ---
+void UAEOA_ItemEffectSubsystem::UnregisterItem(AAEOA_Item* Item)
+{
+	if (!Item || !Items.IsValidIndex(Item->EffectIndex) || Items[Item->EffectIndex] != Item) return;
+
+	const int32 Index = Item->EffectIndex;
+	RevokeEffect(Index);
+
+	Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Effects.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Items.IsValidIndex(Index) && Items[Index])
+	{
+		Items[Index]->EffectIndex = Index;
+	}
+	Item->EffectIndex = INDEX_NONE;
+}
+
+// --- Tick ---
+void UAEOA_ItemEffectSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate >= CVarItemEffectUpdateInterval.GetValueOnGameThread())
+	{
+		TimeSinceUpdate = 0.f;
+		UpdateSignificance();
+	}
+
+	SET_DWORD_STAT(STAT_AEOA_ItemEffectsActive, NumActiveEffects);
+	SET_DWORD_STAT(STAT_AEOA_ItemEffectsPooled, Pool.Num());
+}
+
+// --- UpdateSignificance ---
+// Scores every item by squared distance to the viewer, scaled up for items away from the view direction,
+// then keeps the lowest scores within the budget. Revokes run before grants so freed components are reused.
+void UAEOA_ItemEffectSubsystem::UpdateSignificance()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_ItemEffectSignificance);
+
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (!PlayerController) return;
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	const FVector ViewDirection = ViewRotation.Vector();
+
+	const float MaxDistance = CVarItemEffectMaxDistance.GetValueOnGameThread();
+	const float MaxDistanceSquared = MaxDistance * MaxDistance;
+	const float BehindWeight = FMath::Max(0.f, CVarItemEffectBehindWeight.GetValueOnGameThread());
+	const int32 Budget = FMath::Max(0, CVarItemEffectBudget.GetValueOnGameThread());
+
+	Ranking.Reset();
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		if (!Items[Index]) continue;
+
+		const FVector ToItem = Items[Index]->GetActorLocation() - ViewLocation;
+		const float DistanceSquared = ToItem.SizeSquared();
+		if (DistanceSquared > MaxDistanceSquared) continue;
+
+		// 1 when the item is straight ahead, 0 at 90 degrees, -1 straight behind.
+		const float Facing = FVector::DotProduct(ViewDirection, ToItem.GetSafeNormal());
+		const float Score = DistanceSquared * (1.f + BehindWeight * (1.f - Facing));
+		Ranking.Emplace(Score, Index);
+	}
+	Ranking.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+	Significant.Init(false, Items.Num());
+	const int32 NumSignificant = FMath::Min(Budget, Ranking.Num());
+	for (int32 Rank = 0; Rank < NumSignificant; ++Rank)
+	{
+		Significant[Ranking[Rank].Value] = true;
+	}
+
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		if (!Significant[Index])
+		{
+			RevokeEffect(Index);
+		}
+	}
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		if (Significant[Index] && !Effects[Index])
+		{
+			GrantEffect(Index);
+		}
+	}
+}
+
+// --- GrantEffect ---
+// Reuses a pooled component when available, configured from the item's SpectralxAIEffect template.
+void UAEOA_ItemEffectSubsystem::GrantEffect(int32 Index)
+{
+	AAEOA_Item* Item = Items[Index];
+	if (!Item || Effects[Index]) return;
+
+	UNiagaraComponent* Template = Item->SpectralxAIEffect;
+	UNiagaraComponent* Effect = Pool.Num() > 0 ? Pool.Pop(EAllowShrinking::No) : nullptr;
+	if (!Effect)
+	{
+		// Outer the component to the world, like Niagara's own component pool, so it can move between items.
+		Effect = NewObject<UNiagaraComponent>(GetWorld());
+		Effect->SetAutoActivate(false);
+		Effect->SetAutoDestroy(false);
+		Effect->RegisterComponentWithWorld(GetWorld());
+	}
+
+	Effect->SetAsset(Template->GetAsset());
+	Effect->AttachToComponent(Item->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform, Template->GetAttachSocketName());
+	Effect->SetRelativeTransform(Template->GetRelativeTransform());
+	Effect->Activate(true);
+
+	Effects[Index] = Effect;
+	++NumActiveEffects;
+}
+
+// --- RevokeEffect ---
+void UAEOA_ItemEffectSubsystem::RevokeEffect(int32 Index)
+{
+	UNiagaraComponent* Effect = Effects[Index];
+	if (!Effect) return;
+
+	Effect->DeactivateImmediate();
+	Effect->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	Pool.Push(Effect);
+
+	Effects[Index] = nullptr;
+	--NumActiveEffects;
+}
@@ -0,0 +1,129 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_ItemHoverSubsystem class, animating every
+// hovering item of the world in one batched pass per frame.
+
+#include "Items/AEOA_ItemHoverSubsystem.h"
+#include "Items/AEOA_Item.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Item Hover Tick"), STAT_AEOA_ItemHoverTick, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hovering Items"), STAT_AEOA_HoveringItems, STATGROUP_EchoesOfTheAncients);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_ItemHoverSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_ItemHoverSubsystem::Deinitialize()
+{
+	for (AAEOA_Item* Item : Items)
+	{
+		if (Item)
+		{
+			Item->HoverIndex = INDEX_NONE;
+		}
+	}
+	Items.Empty();
+	BaseLocations.Empty();
+	BaseRotations.Empty();
+	StartTimes.Empty();
+	Amplitudes.Empty();
+	BobRates.Empty();
+	RotationRates.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_ItemHoverSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_ItemHoverSubsystem, STATGROUP_Tickables);
+}
+
+// --- RegisterItem ---
+// Captures the item's current transform and motion settings as the origin of its hover.
+void UAEOA_ItemHoverSubsystem::RegisterItem(AAEOA_Item* Item)
+{
+	if (!Item || Item->HoverIndex != INDEX_NONE) return;
+
+	Item->HoverIndex = Items.Add(Item);
+	BaseLocations.Add(Item->GetActorLocation());
+	BaseRotations.Add(Item->GetActorQuat());
+	StartTimes.Add(GetWorld()->GetTimeSeconds());
+	Amplitudes.Add(Item->Amplitude);
+	BobRates.Add(Item->TimeConstant);
+	RotationRates.Add(FMath::DegreesToRadians(Item->RotationRate));
+}
+
+// --- UnregisterItem ---
+// Removes the item with a swap so the arrays stay contiguous, patching the index of the moved item.
+void UAEOA_ItemHoverSubsystem::UnregisterItem(AAEOA_Item* Item)
+{
+	if (!Item || !Items.IsValidIndex(Item->HoverIndex) || Items[Item->HoverIndex] != Item) return;
+
+	const int32 Index = Item->HoverIndex;
+	Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	BaseLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	BaseRotations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StartTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Amplitudes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	BobRates.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RotationRates.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (Items.IsValidIndex(Index) && Items[Index])
+	{
+		Items[Index]->HoverIndex = Index;
+	}
+	Item->HoverIndex = INDEX_NONE;
+}
+
+// --- Tick ---
+// Evaluates Z = Base.Z + Amplitude * Sin(Rate * t) and Yaw = RotationRate * t for every item,
+// where t is the time since the item started hovering, then moves the items.
+void UAEOA_ItemHoverSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_ItemHoverTick);
+
+	const int32 NumItems = Items.Num();
+	SET_DWORD_STAT(STAT_AEOA_HoveringItems, NumItems);
+	if (NumItems == 0) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Wrap the bob angle in double precision so long sessions do not lose float accuracy.
+	BobAngles.SetNumUninitialized(NumItems, EAllowShrinking::No);
+	BobOffsets.SetNumUninitialized(NumItems, EAllowShrinking::No);
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		BobAngles[Index] = static_cast<float>(FMath::Fmod(BobRates[Index] * (Now - StartTimes[Index]), UE_DOUBLE_TWO_PI));
+	}
+
+	// Evaluate the sine four items at a time, finishing the remainder with scalar math.
+	int32 Index = 0;
+	for (; Index + 4 <= NumItems; Index += 4)
+	{
+		const VectorRegister4Float Angles = VectorLoad(&BobAngles[Index]);
+		const VectorRegister4Float Heights = VectorLoad(&Amplitudes[Index]);
+		VectorStore(VectorMultiply(VectorSin(Angles), Heights), &BobOffsets[Index]);
+	}
+	for (; Index < NumItems; ++Index)
+	{
+		BobOffsets[Index] = Amplitudes[Index] * FMath::Sin(BobAngles[Index]);
+	}
+
+	// Move the root components without physics or overlap updates; the items only bob in place.
+	for (Index = 0; Index < NumItems; ++Index)
+	{
+		AAEOA_Item* Item = Items[Index];
+		if (!Item || !Item->GetRootComponent()) continue;
+
+		const double SpinAngle = FMath::Fmod(RotationRates[Index] * (Now - StartTimes[Index]), UE_DOUBLE_TWO_PI);
+		const FQuat Spin(FVector::UpVector, SpinAngle);
+
+		FVector Location = BaseLocations[Index];
+		Location.Z += BobOffsets[Index];
+		Item->GetRootComponent()->SetWorldLocationAndRotationNoPhysics(Location, (Spin * BaseRotations[Index]).Rotator());
+	}
+}
@@ -0,0 +1,349 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_LootStreamingSubsystem class, preloading loot
+// classes around the player and spawning loot without blocking loads.
+
+#include "Items/AEOA_LootStreamingSubsystem.h"
+#include "Items/AEOA_Item.h"
+#include "Items/AEOA_PickupPoolSubsystem.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "EchoesOfTheAncients/EchoesOfTheAncients.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "UObject/GarbageCollection.h"
+
+DECLARE_CYCLE_STAT(TEXT("Loot Streaming Update"), STAT_AEOA_LootStreamingUpdate, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Loot Classes Requested"), STAT_AEOA_LootClassesRequested, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Deferred Loot Spawns"), STAT_AEOA_DeferredLootSpawns, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarLootPreloadRadius(
+	TEXT("AEOA.Loot.PreloadRadius"),
+	3000.f,
+	TEXT("Distance from the player within which the loot classes of a source are loaded asynchronously (Unreal units)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLootReleaseRadius(
+	TEXT("AEOA.Loot.ReleaseRadius"),
+	4500.f,
+	TEXT("Distance from the player beyond which the loot classes of a source are released. Kept above PreloadRadius to avoid thrashing."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLootUpdateInterval(
+	TEXT("AEOA.Loot.UpdateInterval"),
+	0.5f,
+	TEXT("Seconds between loot preload range evaluations."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorld GLootMemReportCommand(
+	TEXT("AEOA.Loot.MemReport"),
+	TEXT("Logs the memory held by resident loot classes and the assets they reference."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UAEOA_LootStreamingSubsystem* LootSubsystem = World ? World->GetSubsystem<UAEOA_LootStreamingSubsystem>() : nullptr)
+		{
+			LootSubsystem->DumpMemoryReport();
+		}
+	}));
+
+// --- DoesSupportWorldType ---
+bool UAEOA_LootStreamingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_LootStreamingSubsystem::Deinitialize()
+{
+	for (TPair<FSoftObjectPath, FLootClassState>& Pair : ClassStates)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->ReleaseHandle();
+		}
+	}
+	for (TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Pair : DeferredHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	DEC_DWORD_STAT_BY(STAT_AEOA_DeferredLootSpawns, DeferredSpawns.Num());
+	Sources.Empty();
+	ClassStates.Empty();
+	DeferredSpawns.Empty();
+	DeferredHandles.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_LootStreamingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_LootStreamingSubsystem, STATGROUP_Tickables);
+}
+
+// --- RegisterSource ---
+void UAEOA_LootStreamingSubsystem::RegisterSource(AActor* Source, const TArray<FAEOA_LootEntry>& LootTable)
+{
+	if (!Source) return;
+
+	FLootSource& Entry = Sources.AddDefaulted_GetRef();
+	Entry.Source = Source;
+	Entry.Location = Source->GetActorLocation();
+	for (const FAEOA_LootEntry& LootEntry : LootTable)
+	{
+		if (!LootEntry.LootClass.IsNull())
+		{
+			Entry.ClassPaths.AddUnique(LootEntry.LootClass.ToSoftObjectPath());
+		}
+	}
+
+	// Evaluate on the next tick so loot near the player starts loading right away.
+	TimeSinceUpdate = CVarLootUpdateInterval.GetValueOnGameThread();
+}
+
+// --- UnregisterSource ---
+void UAEOA_LootStreamingSubsystem::UnregisterSource(AActor* Source)
+{
+	for (int32 Index = 0; Index < Sources.Num(); ++Index)
+	{
+		if (Sources[Index].Source.Get() == Source)
+		{
+			SetSourceInRange(Sources[Index], false);
+			Sources.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			return;
+		}
+	}
+}
+
+// --- Tick ---
+void UAEOA_LootStreamingSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate >= CVarLootUpdateInterval.GetValueOnGameThread())
+	{
+		TimeSinceUpdate = 0.f;
+		UpdateSources();
+	}
+}
+
+// --- UpdateSources ---
+// Uses two radii so a player walking along the boundary does not load and release the same classes repeatedly.
+void UAEOA_LootStreamingSubsystem::UpdateSources()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_LootStreamingUpdate);
+
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+	if (!PlayerPawn) return;
+
+	const FVector PlayerLocation = PlayerPawn->GetActorLocation();
+	const float PreloadRadius = CVarLootPreloadRadius.GetValueOnGameThread();
+	const float ReleaseRadius = FMath::Max(PreloadRadius, CVarLootReleaseRadius.GetValueOnGameThread());
+
+	for (FLootSource& Source : Sources)
+	{
+		const float DistanceSquared = FVector::DistSquared(Source.Location, PlayerLocation);
+		if (!Source.bInRange && DistanceSquared <= PreloadRadius * PreloadRadius)
+		{
+			SetSourceInRange(Source, true);
+		}
+		else if (Source.bInRange && DistanceSquared > ReleaseRadius * ReleaseRadius)
+		{
+			SetSourceInRange(Source, false);
+		}
+
+		if (Source.bInRange && !Source.bReserved)
+		{
+			ReserveSourcePickups(Source);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AEOA_LootClassesRequested, ClassStates.Num());
+}
+
+// --- SetSourceInRange ---
+// The first in-range source of a class requests it; the last one to leave releases the handle so the class can be collected.
+void UAEOA_LootStreamingSubsystem::SetSourceInRange(FLootSource& Source, bool bInRange)
+{
+	if (Source.bInRange == bInRange) return;
+	Source.bInRange = bInRange;
+
+	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+	for (const FSoftObjectPath& ClassPath : Source.ClassPaths)
+	{
+		if (bInRange)
+		{
+			FLootClassState& State = ClassStates.FindOrAdd(ClassPath);
+			if (State.NumInRange++ == 0)
+			{
+				State.Handle = StreamableManager.RequestAsyncLoad(ClassPath, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+			}
+		}
+		else if (FLootClassState* State = ClassStates.Find(ClassPath))
+		{
+			if (--State->NumInRange <= 0)
+			{
+				if (State->Handle.IsValid())
+				{
+					State->Handle->ReleaseHandle();
+				}
+				ClassStates.Remove(ClassPath);
+			}
+		}
+	}
+}
+
+// --- ReserveSourcePickups ---
+// Waits until every class of the source is resident, then pre-warms one pooled pickup per item class.
+void UAEOA_LootStreamingSubsystem::ReserveSourcePickups(FLootSource& Source)
+{
+	UAEOA_PickupPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UAEOA_PickupPoolSubsystem>();
+
+	for (const FSoftObjectPath& ClassPath : Source.ClassPaths)
+	{
+		if (!ClassPath.ResolveObject()) return;
+	}
+	for (const FSoftObjectPath& ClassPath : Source.ClassPaths)
+	{
+		UClass* LootClass = Cast<UClass>(ClassPath.ResolveObject());
+		if (PoolSubsystem && LootClass && LootClass->IsChildOf(AAEOA_Item::StaticClass()))
+		{
+			PoolSubsystem->ReservePickups(LootClass, 1);
+		}
+	}
+	Source.bReserved = true;
+}
+
+// --- SpawnLoot ---
+void UAEOA_LootStreamingSubsystem::SpawnLoot(const TSoftClassPtr<AActor>& LootClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (LootClass.IsNull()) return;
+
+	if (UClass* ResidentClass = LootClass.Get())
+	{
+		SpawnResidentLoot(ResidentClass, Location, Rotation);
+		return;
+	}
+
+	// Not resident yet (the player broke it before the preload finished): queue the spawn instead of loading synchronously.
+	const FSoftObjectPath ClassPath = LootClass.ToSoftObjectPath();
+	FDeferredSpawn& Deferred = DeferredSpawns.AddDefaulted_GetRef();
+	Deferred.ClassPath = ClassPath;
+	Deferred.Location = Location;
+	Deferred.Rotation = Rotation;
+	INC_DWORD_STAT(STAT_AEOA_DeferredLootSpawns);
+
+	if (!DeferredHandles.Contains(ClassPath))
+	{
+		DeferredHandles.Add(ClassPath, UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			ClassPath,
+			FStreamableDelegate::CreateUObject(this, &UAEOA_LootStreamingSubsystem::OnDeferredLootLoaded, ClassPath),
+			FStreamableManager::AsyncLoadHighPriority));
+	}
+}
+
+// --- OnDeferredLootLoaded ---
+void UAEOA_LootStreamingSubsystem::OnDeferredLootLoaded(FSoftObjectPath ClassPath)
+{
+	UClass* LootClass = Cast<UClass>(ClassPath.ResolveObject());
+	if (!LootClass)
+	{
+		UE_LOG(LogEchoesOfTheAncients, Warning, TEXT("Loot class %s failed to load, dropping its deferred spawns."), *ClassPath.ToString());
+	}
+
+	for (int32 Index = DeferredSpawns.Num() - 1; Index >= 0; --Index)
+	{
+		if (DeferredSpawns[Index].ClassPath != ClassPath) continue;
+
+		if (LootClass)
+		{
+			SpawnResidentLoot(LootClass, DeferredSpawns[Index].Location, DeferredSpawns[Index].Rotation);
+		}
+		DeferredSpawns.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		DEC_DWORD_STAT(STAT_AEOA_DeferredLootSpawns);
+	}
+
+	// The spawned loot now references the class, so the load handle is no longer needed.
+	TSharedPtr<FStreamableHandle> Handle;
+	if (DeferredHandles.RemoveAndCopyValue(ClassPath, Handle) && Handle.IsValid())
+	{
+		Handle->ReleaseHandle();
+	}
+}
+
+// --- SpawnResidentLoot ---
+void UAEOA_LootStreamingSubsystem::SpawnResidentLoot(UClass* LootClass, const FVector& Location, const FRotator& Rotation)
+{
+	UWorld* World = GetWorld();
+	if (!World || !LootClass) return;
+
+	if (LootClass->IsChildOf(AAEOA_Item::StaticClass()))
+	{
+		if (UAEOA_PickupPoolSubsystem* PoolSubsystem = World->GetSubsystem<UAEOA_PickupPoolSubsystem>())
+		{
+			PoolSubsystem->AcquirePickup(LootClass, Location, Rotation);
+			return;
+		}
+	}
+	World->SpawnActor<AActor>(LootClass, Location, Rotation);
+}
+
+// --- DumpMemoryReport ---
+// Walks each resident loot class, its default object and the assets they reference, counting every object once.
+// Run it before and after a preload to see what the loot of an area costs.
+void UAEOA_LootStreamingSubsystem::DumpMemoryReport() const
+{
+	TSet<FSoftObjectPath> ClassPaths;
+	for (const FLootSource& Source : Sources)
+	{
+		ClassPaths.Append(Source.ClassPaths);
+	}
+
+	TSet<UObject*> Visited;
+	int64 TotalBytes = 0;
+	int32 NumResident = 0;
+
+	UE_LOG(LogEchoesOfTheAncients, Log, TEXT("Loot memory report (%d classes referenced, %d requested, %d deferred spawns):"),
+		ClassPaths.Num(), ClassStates.Num(), DeferredSpawns.Num());
+
+	for (const FSoftObjectPath& ClassPath : ClassPaths)
+	{
+		UClass* LootClass = Cast<UClass>(ClassPath.ResolveObject());
+		if (!LootClass)
+		{
+			UE_LOG(LogEchoesOfTheAncients, Log, TEXT("  %s: not resident"), *ClassPath.ToString());
+			continue;
+		}
+		++NumResident;
+
+		int64 ClassBytes = 0;
+		int32 NumObjects = 0;
+		TArray<UObject*> Pending = { LootClass, LootClass->GetDefaultObject() };
+		TArray<UObject*> References;
+		while (Pending.Num() > 0)
+		{
+			UObject* Object = Pending.Pop(EAllowShrinking::No);
+			if (!Object || Visited.Contains(Object)) continue;
+			// Native classes and transient objects are not loot assets.
+			if (Object->GetOutermost()->HasAnyPackageFlags(PKG_CompiledIn) || Object->IsIn(GetTransientPackage())) continue;
+			Visited.Add(Object);
+
+			ClassBytes += Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+			++NumObjects;
+
+			References.Reset();
+			FReferenceFinder ReferenceFinder(References, nullptr, false, true, false, true);
+			ReferenceFinder.FindReferences(Object);
+			Pending.Append(References);
+		}
+
+		TotalBytes += ClassBytes;
+		UE_LOG(LogEchoesOfTheAncients, Log, TEXT("  %s: %.1f KB across %d objects not counted by an earlier class"),
+			*ClassPath.ToString(), ClassBytes / 1024.0, NumObjects);
+	}
+
+	UE_LOG(LogEchoesOfTheAncients, Log, TEXT("  Total: %d of %d loot classes resident, %.1f KB"), NumResident, ClassPaths.Num(), TotalBytes / 1024.0);
+}
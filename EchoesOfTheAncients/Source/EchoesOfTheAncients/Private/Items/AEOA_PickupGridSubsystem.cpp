@@ -0,0 +1,212 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_PickupGridSubsystem class, hashing hovering
+// pickups into grid cells and answering proximity queries around Aria.
+
+#include "Items/AEOA_PickupGridSubsystem.h"
+#include "Items/AEOA_Item.h"
+#include "Components/SphereComponent.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Pickup Grid Query"), STAT_AEOA_PickupGridQuery, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickups In Grid"), STAT_AEOA_PickupsInGrid, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarPickupGridCellSize(
+	TEXT("AEOA.PickupGrid.CellSize"),
+	250.f,
+	TEXT("Edge length of a pickup grid cell in Unreal units. Read when a world is created."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPickupGridMaxScanned(
+	TEXT("AEOA.PickupGrid.MaxScanned"),
+	64,
+	TEXT("Maximum number of pickups within reach a single pickup query scores, bounding its cost in dense piles. The querier's own cell is always scanned in full."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPickupGridFacingWeight(
+	TEXT("AEOA.PickupGrid.FacingWeight"),
+	1.f,
+	TEXT("How strongly pickups outside the facing direction are penalized. 0 ranks by distance only."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_PickupGridSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Initialize ---
+void UAEOA_PickupGridSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(1.f, CVarPickupGridCellSize.GetValueOnGameThread());
+}
+
+// --- Deinitialize ---
+void UAEOA_PickupGridSubsystem::Deinitialize()
+{
+	for (AAEOA_Item* Item : Items)
+	{
+		if (Item)
+		{
+			Item->GridIndex = INDEX_NONE;
+		}
+	}
+	DEC_DWORD_STAT_BY(STAT_AEOA_PickupsInGrid, Items.Num());
+	Items.Empty();
+	Locations.Empty();
+	Radii.Empty();
+	CellKeys.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetCellKey ---
+FIntPoint UAEOA_PickupGridSubsystem::GetCellKey(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+// --- RegisterItem ---
+void UAEOA_PickupGridSubsystem::RegisterItem(AAEOA_Item* Item)
+{
+	if (!Item || Item->GridIndex != INDEX_NONE || !Item->Sphere) return;
+
+	const FVector Location = Item->GetActorLocation();
+	const float Radius = Item->Sphere->GetScaledSphereRadius();
+	const FIntPoint CellKey = GetCellKey(Location);
+
+	const int32 Index = Items.Add(Item);
+	Locations.Add(Location);
+	Radii.Add(Radius);
+	CellKeys.Add(CellKey);
+	Cells.FindOrAdd(CellKey).Add(Index);
+
+	Item->GridIndex = Index;
+	MaxItemRadius = FMath::Max(MaxItemRadius, Radius);
+	INC_DWORD_STAT(STAT_AEOA_PickupsInGrid);
+}
+
+// --- UnregisterItem ---
+// Removes the item with a swap, then renames the moved item's slot inside its cell.
+void UAEOA_PickupGridSubsystem::UnregisterItem(AAEOA_Item* Item)
+{
+	if (!Item || !Items.IsValidIndex(Item->GridIndex) || Items[Item->GridIndex] != Item) return;
+
+	const int32 Index = Item->GridIndex;
+	const int32 LastIndex = Items.Num() - 1;
+
+	if (TArray<int32, TInlineAllocator<8>>* Cell = Cells.Find(CellKeys[Index]))
+	{
+		Cell->RemoveSingleSwap(Index, EAllowShrinking::No);
+		if (Cell->IsEmpty())
+		{
+			Cells.Remove(CellKeys[Index]);
+		}
+	}
+	if (Index != LastIndex)
+	{
+		if (TArray<int32, TInlineAllocator<8>>* LastCell = Cells.Find(CellKeys[LastIndex]))
+		{
+			const int32 Slot = LastCell->Find(LastIndex);
+			if (Slot != INDEX_NONE)
+			{
+				(*LastCell)[Slot] = Index;
+			}
+		}
+	}
+
+	Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	CellKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (Items.IsValidIndex(Index) && Items[Index])
+	{
+		Items[Index]->GridIndex = Index;
+	}
+	Item->GridIndex = INDEX_NONE;
+	DEC_DWORD_STAT(STAT_AEOA_PickupsInGrid);
+}
+
+// --- QueryCandidates ---
+// Visits only the cells within reach of the querier and keeps the best candidates in a small sorted buffer,
+// so the cost depends on the query radius and scan cap rather than on the number of pickups in the level.
+void UAEOA_PickupGridSubsystem::QueryCandidates(const FVector& Location, const FVector& Forward, float QueryRadius, float QueryHalfHeight, int32 MaxCandidates, TArray<AAEOA_Item*, TInlineAllocator<4>>& OutCandidates) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_PickupGridQuery);
+
+	OutCandidates.Reset();
+	if (MaxCandidates <= 0 || Items.IsEmpty()) return;
+
+	const float Reach = QueryRadius + MaxItemRadius;
+	const FIntPoint MinCell = GetCellKey(Location - FVector(Reach, Reach, 0.f));
+	const FIntPoint MaxCell = GetCellKey(Location + FVector(Reach, Reach, 0.f));
+	const FVector FlatForward = Forward.GetSafeNormal2D();
+	const float FacingWeight = FMath::Max(0.f, CVarPickupGridFacingWeight.GetValueOnGameThread());
+	int32 Budget = FMath::Max(1, CVarPickupGridMaxScanned.GetValueOnGameThread());
+
+	// (score, item index) pairs sorted by ascending score, at most MaxCandidates long.
+	TArray<TPair<float, int32>, TInlineAllocator<8>> Best;
+
+	// Cells are visited in rings around the querier's cell, so the budget is spent on the nearest pickups first,
+	// and the querier's own cell is always scanned in full.
+	const FIntPoint CenterCell = GetCellKey(Location);
+	const int32 MaxRing = FMath::Max(FMath::Max(CenterCell.X - MinCell.X, MaxCell.X - CenterCell.X), FMath::Max(CenterCell.Y - MinCell.Y, MaxCell.Y - CenterCell.Y));
+
+	for (int32 Ring = 0; Ring <= MaxRing && (Ring == 0 || Budget > 0); ++Ring)
+	{
+		for (int32 CellX = FMath::Max(CenterCell.X - Ring, MinCell.X); CellX <= FMath::Min(CenterCell.X + Ring, MaxCell.X); ++CellX)
+		{
+			for (int32 CellY = FMath::Max(CenterCell.Y - Ring, MinCell.Y); CellY <= FMath::Min(CenterCell.Y + Ring, MaxCell.Y); ++CellY)
+			{
+				// Only the border of the ring; its inside was visited by the previous rings.
+				if (FMath::Max(FMath::Abs(CellX - CenterCell.X), FMath::Abs(CellY - CenterCell.Y)) != Ring) continue;
+
+				const TArray<int32, TInlineAllocator<8>>* Cell = Cells.Find(FIntPoint(CellX, CellY));
+				if (!Cell) continue;
+
+				for (const int32 Index : *Cell)
+				{
+					if (Ring > 0 && Budget <= 0) break;
+
+					// Treat the querier as a vertical cylinder, like a character capsule.
+					const FVector ToItem = Locations[Index] - Location;
+					if (FMath::Abs(ToItem.Z) > Radii[Index] + QueryHalfHeight) continue;
+					const float Range = Radii[Index] + QueryRadius;
+					const float DistanceSquared = ToItem.SizeSquared2D();
+					if (DistanceSquared > Range * Range) continue;
+
+					// Only pickups within reach count against the budget.
+					--Budget;
+
+					// 1 when the pickup is straight ahead, 0 at 90 degrees, -1 straight behind.
+					const float Facing = FVector::DotProduct(FlatForward, ToItem.GetSafeNormal2D());
+					const float Score = DistanceSquared * (1.f + FacingWeight * (1.f - Facing));
+					if (Best.Num() == MaxCandidates && Score >= Best.Last().Key) continue;
+
+					int32 Insert = Best.Num();
+					while (Insert > 0 && Best[Insert - 1].Key > Score)
+					{
+						--Insert;
+					}
+					Best.Insert(TPair<float, int32>(Score, Index), Insert);
+					if (Best.Num() > MaxCandidates)
+					{
+						Best.Pop(EAllowShrinking::No);
+					}
+				}
+			}
+		}
+	}
+
+	for (const TPair<float, int32>& Candidate : Best)
+	{
+		if (Items[Candidate.Value])
+		{
+			OutCandidates.Add(Items[Candidate.Value]);
+		}
+	}
+}
@@ -0,0 +1,151 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_PickupPoolSubsystem class, recycling pickup
+// actors per class and tracking pool hit and miss rates.
+
+#include "Items/AEOA_PickupPoolSubsystem.h"
+#include "Items/AEOA_Item.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "EchoesOfTheAncients/EchoesOfTheAncients.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickup Pool Hits"), STAT_AEOA_PickupPoolHits, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickup Pool Misses"), STAT_AEOA_PickupPoolMisses, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickups Pooled"), STAT_AEOA_PickupsPooled, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<int32> CVarPickupPoolMaxReserve(
+	TEXT("AEOA.PickupPool.MaxReservePerClass"),
+	32,
+	TEXT("Upper bound on the number of pickups pre-warmed per class at level load."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorld GDumpPickupPoolCommand(
+	TEXT("AEOA.PickupPool.Dump"),
+	TEXT("Logs the size and hit rate of every pickup pool in the current world."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UAEOA_PickupPoolSubsystem* PoolSubsystem = World ? World->GetSubsystem<UAEOA_PickupPoolSubsystem>() : nullptr)
+		{
+			PoolSubsystem->DumpStats();
+		}
+	}));
+
+// --- DoesSupportWorldType ---
+bool UAEOA_PickupPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- Deinitialize ---
+void UAEOA_PickupPoolSubsystem::Deinitialize()
+{
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- ReservePickups ---
+// Spawns the dormant instances right away so no pickup has to be constructed mid-combat.
+void UAEOA_PickupPoolSubsystem::ReservePickups(TSubclassOf<AAEOA_Item> PickupClass, int32 Count)
+{
+	if (!PickupClass || Count <= 0) return;
+
+	FAEOA_PickupPool& Pool = Pools.FindOrAdd(PickupClass);
+	const int32 MaxReserve = CVarPickupPoolMaxReserve.GetValueOnGameThread();
+	const int32 NewReserved = FMath::Min(Pool.Reserved + Count, MaxReserve);
+	const int32 ToSpawn = NewReserved - Pool.Reserved;
+	Pool.Reserved = NewReserved;
+
+	for (int32 Index = 0; Index < ToSpawn; ++Index)
+	{
+		if (AAEOA_Item* Pickup = SpawnPooledPickup(PickupClass))
+		{
+			Pool.Available.Add(Pickup);
+			INC_DWORD_STAT(STAT_AEOA_PickupsPooled);
+		}
+	}
+}
+
+// --- AcquirePickup ---
+// Wakes a pooled instance at the requested transform, or spawns one on a miss.
+AAEOA_Item* UAEOA_PickupPoolSubsystem::AcquirePickup(TSubclassOf<AAEOA_Item> PickupClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (!PickupClass) return nullptr;
+
+	FAEOA_PickupPool& Pool = Pools.FindOrAdd(PickupClass);
+
+	AAEOA_Item* Pickup = nullptr;
+	while (!Pickup && Pool.Available.Num() > 0)
+	{
+		Pickup = Pool.Available.Pop(EAllowShrinking::No);
+		if (!IsValid(Pickup))
+		{
+			Pickup = nullptr;
+			continue;
+		}
+		DEC_DWORD_STAT(STAT_AEOA_PickupsPooled);
+	}
+
+	if (Pickup)
+	{
+		++Pool.Hits;
+		INC_DWORD_STAT(STAT_AEOA_PickupPoolHits);
+	}
+	else
+	{
+		++Pool.Misses;
+		INC_DWORD_STAT(STAT_AEOA_PickupPoolMisses);
+		Pickup = SpawnPooledPickup(PickupClass);
+		if (!Pickup) return nullptr;
+	}
+
+	Pickup->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+	Pickup->OnAcquiredFromPool();
+	return Pickup;
+}
+
+// --- ReleasePickup ---
+void UAEOA_PickupPoolSubsystem::ReleasePickup(AAEOA_Item* Pickup)
+{
+	if (!IsValid(Pickup)) return;
+
+	// A pickup released twice would be parked twice and later handed out to two callers.
+	FAEOA_PickupPool& Pool = Pools.FindOrAdd(Pickup->GetClass());
+	if (Pool.Available.Contains(Pickup)) return;
+
+	Pickup->OnReleasedToPool();
+	Pool.Available.Add(Pickup);
+	INC_DWORD_STAT(STAT_AEOA_PickupsPooled);
+}
+
+// --- DumpStats ---
+void UAEOA_PickupPoolSubsystem::DumpStats() const
+{
+	UE_LOG(LogEchoesOfTheAncients, Log, TEXT("Pickup pools (%d classes):"), Pools.Num());
+	for (const TPair<UClass*, FAEOA_PickupPool>& Pair : Pools)
+	{
+		const FAEOA_PickupPool& Pool = Pair.Value;
+		const int32 Requests = Pool.Hits + Pool.Misses;
+		const float HitRate = Requests > 0 ? 100.f * Pool.Hits / Requests : 0.f;
+		UE_LOG(LogEchoesOfTheAncients, Log, TEXT("  %s: available %d, reserved %d, spawned %d, hits %d, misses %d, hit rate %.1f%%"),
+			*GetNameSafe(Pair.Key), Pool.Available.Num(), Pool.Reserved, Pool.Spawned, Pool.Hits, Pool.Misses, HitRate);
+	}
+}
+
+// --- SpawnPooledPickup ---
+// Spawns deferred so the pickup is dormant before BeginPlay and never registers as hovering.
+AAEOA_Item* UAEOA_PickupPoolSubsystem::SpawnPooledPickup(UClass* PickupClass)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	AAEOA_Item* Pickup = World->SpawnActorDeferred<AAEOA_Item>(PickupClass, FTransform::Identity, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Pickup) return nullptr;
+
+	Pickup->OnReleasedToPool();
+	Pickup->FinishSpawning(FTransform::Identity);
+
+	++Pools.FindOrAdd(PickupClass).Spawned;
+	return Pickup;
+}
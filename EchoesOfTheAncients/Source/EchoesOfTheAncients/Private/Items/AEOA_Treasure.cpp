@@ -3,12 +3,11 @@
 
 #include "Items/AEOA_Treasure.h"
 #include "Characters/AriaCharacter.h"
-#include "Components/SphereComponent.h"
+#include "Items/AEOA_PickupPoolSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 
-void AAEOA_Treasure::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+bool AAEOA_Treasure::HandlePickupProximity(AAriaCharacter* AriaCharacter)
 {
-    AAriaCharacter* AriaCharacter = Cast<AAriaCharacter>(OtherActor);
     if (AriaCharacter)
     {
         if (PickupSound)
@@ -23,6 +22,16 @@ void AAEOA_Treasure::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, A
                 AriaCharacter->IncrementDawnspireCount();
             }
         }
-        Destroy();
+
+        // Return the treasure to its pool so the next breakable can reuse it instead of spawning a new actor.
+        if (UAEOA_PickupPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UAEOA_PickupPoolSubsystem>())
+        {
+            PoolSubsystem->ReleasePickup(this);
+        }
+        else
+        {
+            Destroy();
+        }
     }
+    return true;
 }
@@ -2,30 +2,78 @@
 // Implements the AAEOA_Weapon class, providing functionality 
 // for weapons in Echoes of the Ancients.
 // This class handles weapon equipping, attachment to character sockets, 
-// collision detection setup, and overlap event handling.
+// collision detection setup, and weapon box overlap handling.
 
 #include "Items/Weapons/AEOA_Weapon.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
 #include "Characters/AriaCharacter.h"
+#include "Combat/AEOA_BladeTrajectoryAsset.h"
+#include "Combat/AEOA_CombatResolutionSubsystem.h"
+#include "Combat/AEOA_CombatTraceSubsystem.h"
+#include "Combat/AEOA_FieldApplicationSubsystem.h"
+#include "Components/AEOA_HurtboxComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/SceneComponent.h"
-#include "Components/SphereComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "DrawDebugHelpers.h"
+#include "EchoesOfTheAncients/AEOA_CollisionChannels.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "HAL/IConsoleManager.h"
 #include "Interfaces/HitInterface.h"
 #include "Kismet/GameplayStatics.h"
-#include "Kismet/KismetSystemLibrary.h"
-#include "NiagaraComponent.h"
 
+DECLARE_CYCLE_STAT(TEXT("Blade Sweep"), STAT_AEOA_BladeSweep, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blade Sweep Substeps"), STAT_AEOA_BladeSweepSubsteps, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarBladeSweepDegreesPerSubstep(
+    TEXT("AEOA.Weapon.SweepDegreesPerSubstep"),
+    15.f,
+    TEXT("Maximum blade rotation covered by one sweep sub-step, in degrees. Fast swings get more sub-steps."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarBladeSweepDistancePerSubstep(
+    TEXT("AEOA.Weapon.SweepDistancePerSubstep"),
+    30.f,
+    TEXT("Maximum blade tip travel covered by one sweep sub-step, in Unreal units."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBladeSweepMaxSubsteps(
+    TEXT("AEOA.Weapon.SweepMaxSubsteps"),
+    8,
+    TEXT("Upper bound on the number of blade sweep sub-steps per frame."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarBladeSweepDraw(
+    TEXT("AEOA.Weapon.DrawSweeps"),
+    false,
+    TEXT("Draws every blade sweep sub-step (green) and hit (red)."),
+    ECVF_Cheat);
+
+static TAutoConsoleVariable<bool> CVarBladeUseBakedTrajectory(
+    TEXT("AEOA.Weapon.UseBakedTrajectory"),
+    true,
+    TEXT("Rebuild the blade from the weapon's baked trajectory while its montage plays. 0 always reads the animated blade components."),
+    ECVF_Default);
 
 // --- Constructor ---
 // Initializes the weapon with a box component for collision detection.
 AAEOA_Weapon::AAEOA_Weapon()
 {
+    // Ticks only while the collision window is open, after animation has placed the blade for the frame.
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
+    PrimaryActorTick.TickGroup = TG_PostPhysics;
+
     WeaponBox = CreateDefaultSubobject<UBoxComponent>(TEXT("Weapon Box"));
     WeaponBox->SetupAttachment(GetRootComponent());
 
-    // Set collision presets to query only, overlap all channels except Pawn to avoid self-overlaps.
+    // Set collision presets to query only, overlapping hurtbox shapes and nothing else.
     WeaponBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-    WeaponBox->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
-    WeaponBox->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Ignore);
+    WeaponBox->SetCollisionObjectType(ECC_AEOA_WeaponBox);  // Only the Hurtbox profile overlaps this channel.
+    WeaponBox->SetGenerateOverlapEvents(true);
+    WeaponBox->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
+    WeaponBox->SetCollisionResponseToChannel(ECC_AEOA_Hurtbox, ECollisionResponse::ECR_Overlap);
 
     BoxTraceStart = CreateDefaultSubobject<USceneComponent>(TEXT("Box Trace Start"));
     BoxTraceStart->SetupAttachment(GetRootComponent());
@@ -43,26 +91,7 @@ void AAEOA_Weapon::BeginPlay()
     WeaponBox->OnComponentBeginOverlap.AddDynamic(this, &AAEOA_Weapon::OnBoxOverlap);
 }
 
-// --- Overlap Begin Callback ---
-// Triggered when the Sphere component begins overlapping with another actor, setting the overlapping item on Aria.
-void AAEOA_Weapon::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
-{
-    // Call the parent class (AItem) version of OnSphereOverlap to 
-    // maintain inherited overlap functionality.
-    Super::OnSphereOverlap(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex, bFromSweep, SweepResult);
-    
-}
-
-// --- Overlap End Callback ---
-// Triggered when the Sphere component stops overlapping with another actor, clearing the overlapping item on Aria.
-void AAEOA_Weapon::OnSphereEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
-{
-    // Call the parent class (AItem) version of OnSphereEndOverlap 
-    // to maintain inherited overlap functionality.
-    Super::OnSphereEndOverlap(OverlappedComponent, OtherActor, OtherComp, OtherBodyIndex);
-}
-
-/// Equips the weapon by attaching it to the specified parent component and socket, setting owner and instigator, plays an equip sound, and deactivates the SpectralxAI effect.
+/// Equips the weapon by attaching it to the specified parent component and socket, setting owner and instigator, plays an equip sound, and releases the SpectralxAI effect.
 /// @param InParent The parent component to attach the weapon to (e.g., Aria’s skeletal mesh).
 /// @param InSocketName The name of the socket to attach the weapon to (e.g., "R_hand_weapon").
 /// @param NewOwner The actor that owns the weapon (e.g., AAriaCharacter).
@@ -82,16 +111,7 @@ void AAEOA_Weapon::Equip(USceneComponent* InParent, FName InSocketName, AActor*
             GetActorLocation()
         );
     }
-    // Disable the sphere’s collision to prevent re-overlapping after equipping.
-    if (Sphere)
-    {
-        Sphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-    }
-    // Deactivate the SpectralxAI effect to stop the visual cue once the weapon is equipped.
-    if (SpectralxAIEffect)
-    {
-        SpectralxAIEffect->Deactivate();
-    }
+    // The SpectralxAI effect and the pickup grid entry are released when AttachMeshToSocket sets the equipped state.
 }
 
 // --- AttachMeshToSocket ---
@@ -102,64 +122,218 @@ void AAEOA_Weapon::AttachMeshToSocket(USceneComponent* InParent, const FName& In
     FAttachmentTransformRules TransformRules(EAttachmentRule::SnapToTarget, true);
     // Attach the ItemMesh to the specified parent component (e.g., Aria’s skeletal mesh) at the given socket.
     ItemMesh->AttachToComponent(InParent, TransformRules, InSocketName);
-    // Set the item state to equipped to stop hovering behavior.
-    ItemState = EItemState::EIS_Equipped;
+    // Set the item state to equipped to stop hovering behavior (unregisters from the hover subsystem).
+    SetItemState(EItemState::EIS_Equipped);
 }
 
-// --- Box Overlap Callback ---
-// Triggered when the WeaponBox begins overlapping with another actor, performs a box trace to detect the impact point.
-void AAEOA_Weapon::OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+// --- Tick ---
+void AAEOA_Weapon::Tick(float DeltaTime)
 {
-    // Get the start and end positions for the box trace from the scene components.
-    const FVector Start = BoxTraceStart->GetComponentLocation();
-    const FVector End = BoxTraceEnd->GetComponentLocation();
+    Super::Tick(DeltaTime);
 
-    // Create an array of actors to ignore during the trace (ignore the weapon itself to prevent self-hits).
-    TArray<AActor*> ActorsToIgnore;
-    ActorsToIgnore.Add(this);
+    SweepBlade();
+}
 
-    for (AActor* Actor : IgnoreActors)
+// --- SetCollisionWindowEnabled ---
+// Opening a window starts a new swing: the previously hit actors are forgotten and the first sweep starts from the current pose.
+// Closing keeps the swing so async results of its last frame still apply.
+void AAEOA_Weapon::SetCollisionWindowEnabled(ECollisionEnabled::Type CollisionEnabled)
+{
+    const bool bOpen = CollisionEnabled != ECollisionEnabled::NoCollision;
+
+    if (bOpen)
     {
-        ActorsToIgnore.AddUnique(Actor);
+        HitRegistry.BeginSwing(this, GetOwner());
     }
+    bHasPreviousBladePose = false;
 
-    // Perform the box trace using the Visibility channel to detect the first blocking hit.
-    FHitResult BoxHit;
-    UKismetSystemLibrary::BoxTraceSingle(
-        this,  // World context object (this weapon, an actor in the world).
-        Start,  // Start position of the trace (base of the blade).
-        End,  // End position of the trace (tip of the blade).
-        FVector(5.f, 5.f, 5.f),  // Box half-size (5 units in each dimension for a small box).
-        BoxTraceStart->GetComponentRotation(),  // Orientation of the box (matches the start component’s rotation).
-        ETraceTypeQuery::TraceTypeQuery1,  // Visibility channel (TraceTypeQuery1 corresponds to Visibility).
-        false,  // Do not trace complex geometry (faster, uses simple collision shapes).
-        ActorsToIgnore,  // Actors to ignore during the trace.
-        EDrawDebugTrace::None,  // Draw debug for 5 seconds (red until hit, green on hit).
-        BoxHit,  // Hit result (output, populated with impact data).
-        true  // Ignore self (redundant since we added 'this' to ActorsToIgnore, but required).
-    );
-
-    // If the trace hits an actor, check if it implements IHitInterface and call GetHit.
-    if (BoxHit.GetActor())
+    if (bContinuousCollision)
     {
-        IHitInterface* HitInterface = Cast<IHitInterface>(BoxHit.GetActor());
-        if (HitInterface)
+        WeaponBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        SetActorTickEnabled(bOpen);
+        if (bOpen)
         {
-            // Apply damage to the hit actor using the weapon’s damage value.
-            UGameplayStatics::ApplyDamage(
-                BoxHit.GetActor(),  // The actor to damage (e.g., an enemy).
-                Damage,  // The amount of damage to apply.
-                GetInstigator()->GetController(),  // The controller responsible for the damage (e.g., Aria’s controller).
-                this,  // The damage causer (this weapon).
-                UDamageType::StaticClass()  // The damage type class (default UDamageType).
-            );
-
-            HitInterface->Execute_GetHit(BoxHit.GetActor(), BoxHit.ImpactPoint);  // Execute GetHit on the hit actor, passing the impact point.
-        
-            IgnoreActors.AddUnique(BoxHit.GetActor()); // Add the hit actor to IgnoreActors to prevent multiple hits.
-
-            CreateFields(BoxHit.ImpactPoint);  // Create Field System fields at the impact point to break destructible objects.
-            
+            SweepBlade();
         }
     }
-}
\ No newline at end of file
+    else
+    {
+        WeaponBox->SetCollisionEnabled(CollisionEnabled);
+    }
+}
+
+// --- SweepBlade ---
+// The number of sub-steps adapts to how far the blade rotated and how far its tip travelled since the last frame,
+// so slow swings cost one sweep while a 360 at 30 fps is still covered in small arcs.
+void AAEOA_Weapon::SweepBlade()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AEOA_BladeSweep);
+
+    FVector BladeStart;
+    FVector BladeEnd;
+    GetBladePose(BladeStart, BladeEnd);
+
+    if (!bHasPreviousBladePose)
+    {
+        // First frame of the window: test the blade where it is, like the single trace of the overlap mode.
+        SweepBladeStep(BladeStart, BladeEnd, BladeStart, BladeEnd);
+        INC_DWORD_STAT(STAT_AEOA_BladeSweepSubsteps);
+    }
+    else
+    {
+        const FVector PreviousDirection = (PreviousBladeEnd - PreviousBladeStart).GetSafeNormal();
+        const FVector Direction = (BladeEnd - BladeStart).GetSafeNormal();
+        const float AngleDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(FVector::DotProduct(PreviousDirection, Direction), -1.f, 1.f)));
+        const float TipTravel = FVector::Dist(PreviousBladeEnd, BladeEnd);
+
+        const int32 NumSubsteps = FMath::Clamp(
+            FMath::Max(
+                FMath::CeilToInt32(AngleDegrees / FMath::Max(1.f, CVarBladeSweepDegreesPerSubstep.GetValueOnGameThread())),
+                FMath::CeilToInt32(TipTravel / FMath::Max(1.f, CVarBladeSweepDistancePerSubstep.GetValueOnGameThread()))),
+            1,
+            FMath::Max(1, CVarBladeSweepMaxSubsteps.GetValueOnGameThread()));
+
+        FVector FromStart = PreviousBladeStart;
+        FVector FromEnd = PreviousBladeEnd;
+        for (int32 Substep = 1; Substep <= NumSubsteps; ++Substep)
+        {
+            const float Alpha = static_cast<float>(Substep) / NumSubsteps;
+            const FVector ToStart = FMath::Lerp(PreviousBladeStart, BladeStart, Alpha);
+            const FVector ToEnd = FMath::Lerp(PreviousBladeEnd, BladeEnd, Alpha);
+            SweepBladeStep(FromStart, FromEnd, ToStart, ToEnd);
+            FromStart = ToStart;
+            FromEnd = ToEnd;
+        }
+        INC_DWORD_STAT_BY(STAT_AEOA_BladeSweepSubsteps, NumSubsteps);
+    }
+
+    PreviousBladeStart = BladeStart;
+    PreviousBladeEnd = BladeEnd;
+    bHasPreviousBladePose = true;
+}
+
+// --- GetBladePose ---
+void AAEOA_Weapon::GetBladePose(FVector& OutStart, FVector& OutEnd) const
+{
+    if (BladeTrajectory && CVarBladeUseBakedTrajectory.GetValueOnGameThread() && GetBakedBladePose(OutStart, OutEnd)) return;
+
+    OutStart = BoxTraceStart->GetComponentLocation();
+    OutEnd = BoxTraceEnd->GetComponentLocation();
+}
+
+// --- GetBakedBladePose ---
+// The montage position advances with the anim instance update even when bones are not evaluated,
+// and the mesh transform follows the capsule, so the blade is correct for off-screen or animation-LOD'd wielders.
+bool AAEOA_Weapon::GetBakedBladePose(FVector& OutStart, FVector& OutEnd) const
+{
+    const USkeletalMeshComponent* WielderMesh = Cast<USkeletalMeshComponent>(ItemMesh->GetAttachParent());
+    if (!WielderMesh || ItemMesh->GetAttachSocketName() != BladeTrajectory->SocketName) return false;
+
+    const UAnimInstance* AnimInstance = WielderMesh->GetAnimInstance();
+    UAnimMontage* Montage = BladeTrajectory->Montage;
+    if (!AnimInstance || !Montage || !AnimInstance->Montage_IsPlaying(Montage)) return false;
+
+    FTransform SocketTransform;
+    if (!BladeTrajectory->SampleSocket(AnimInstance->Montage_GetCurrentSection(Montage), AnimInstance->Montage_GetPosition(Montage), SocketTransform)) return false;
+
+    // The weapon snaps to the socket, so the trace components keep their relative offsets from the socket.
+    const FTransform SocketWorld = SocketTransform * WielderMesh->GetComponentTransform();
+    OutStart = SocketWorld.TransformPosition(BoxTraceStart->GetRelativeLocation());
+    OutEnd = SocketWorld.TransformPosition(BoxTraceEnd->GetRelativeLocation());
+    return true;
+}
+
+// --- SweepBladeStep ---
+// Sweeps a box spanning the blade from the center of one pose to the center of the next, oriented like the later pose.
+// The sweep runs through UAEOA_CombatTraceSubsystem, which reports the hits in the order the steps were queued.
+void AAEOA_Weapon::SweepBladeStep(const FVector& FromStart, const FVector& FromEnd, const FVector& ToStart, const FVector& ToEnd)
+{
+    const FVector Blade = ToEnd - ToStart;
+    const float HalfLength = FMath::Max(Blade.Size() * 0.5f, BladeHalfThickness);
+    const FQuat Rotation = FRotationMatrix::MakeFromX(Blade.GetSafeNormal()).ToQuat();
+    const FCollisionShape Shape = FCollisionShape::MakeBox(FVector(HalfLength, BladeHalfThickness, BladeHalfThickness));
+    const FVector From = (FromStart + FromEnd) * 0.5f;
+    const FVector To = (ToStart + ToEnd) * 0.5f;
+
+    if (UAEOA_CombatTraceSubsystem* TraceSubsystem = GetWorld()->GetSubsystem<UAEOA_CombatTraceSubsystem>())
+    {
+        TraceSubsystem->QueueWeaponSweep(this, HitRegistry.GetSwingId(), From, To, Rotation, Shape, HitRegistry.GetQueryParams());
+    }
+
+    if (CVarBladeSweepDraw.GetValueOnGameThread())
+    {
+        DrawDebugBox(GetWorld(), To, Shape.GetExtent(), Rotation, FColor::Green, false, 2.f);
+    }
+}
+
+// --- ReceiveSweepHits ---
+// Hits of an older swing can arrive after a new window opened when traces are async; they are dropped.
+void AAEOA_Weapon::ReceiveSweepHits(int32 InSwingId, TConstArrayView<FHitResult> Hits)
+{
+    if (InSwingId != HitRegistry.GetSwingId()) return;
+
+    for (const FHitResult& Hit : Hits)
+    {
+        if (CVarBladeSweepDraw.GetValueOnGameThread())
+        {
+            DrawDebugPoint(GetWorld(), Hit.ImpactPoint, 10.f, FColor::Red, false, 2.f);
+        }
+        ProcessBladeHit(Hit);
+    }
+}
+
+// --- ProcessBladeHit ---
+// Queues the hit for the end-of-frame resolution pass, ignoring actors already hit this swing.
+// Damage, the hit reaction and the fields are applied there, outside of any trace or overlap callback.
+void AAEOA_Weapon::ProcessBladeHit(const FHitResult& Hit)
+{
+    AActor* HitActor = Hit.GetActor();
+    if (!HitActor || HitActor == this || HitActor == GetOwner()) return;
+
+    // Register the hit so the rest of the swing, including later sub-steps, cannot hit the actor again.
+    if (!HitActor->Implements<UHitInterface>() || !HitRegistry.RegisterHit(HitActor)) return;
+
+    if (UAEOA_CombatResolutionSubsystem* ResolutionSubsystem = GetWorld()->GetSubsystem<UAEOA_CombatResolutionSubsystem>())
+    {
+        FAEOA_HitRecord Record;
+        Record.Attacker = GetInstigatorController();  // The controller responsible for the damage (e.g., Aria’s controller).
+        Record.Victim = HitActor;  // The actor to damage (e.g., an enemy).
+        Record.Weapon = this;  // The damage causer and owner of the fields.
+        Record.ImpactPoint = Hit.ImpactPoint;  // Where the reaction and the fields are played.
+        Record.Damage = Damage * UAEOA_HurtboxComponent::GetDamageMultiplier(Hit.GetComponent());  // The weapon’s damage, scaled by the hurtbox shape hit first.
+        Record.SwingId = HitRegistry.GetSwingId();  // The swing the hit belongs to.
+        ResolutionSubsystem->QueueHit(Record);
+    }
+}
+
+// --- ApplyHitFields ---
+// Native fields are merged and pooled by the subsystem; CreateFields stays available as a Blueprint fallback.
+void AAEOA_Weapon::ApplyHitFields(const FVector& ImpactPoint)
+{
+    UAEOA_FieldApplicationSubsystem* FieldSubsystem = GetWorld()->GetSubsystem<UAEOA_FieldApplicationSubsystem>();
+    if (FieldSubsystem && FieldSubsystem->QueueImpact(ImpactPoint, FieldRadius, FieldStrain, FieldImpulse)) return;
+
+    CreateFields(ImpactPoint);
+}
+
+// --- Box Overlap Callback ---
+// Triggered when the WeaponBox begins overlapping with another actor, performs a box trace to detect the impact point.
+void AAEOA_Weapon::OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    // Get the start and end positions for the box trace from the scene components.
+    const FVector Start = BoxTraceStart->GetComponentLocation();
+    const FVector End = BoxTraceEnd->GetComponentLocation();
+
+    if (UAEOA_CombatTraceSubsystem* TraceSubsystem = GetWorld()->GetSubsystem<UAEOA_CombatTraceSubsystem>())
+    {
+        TraceSubsystem->QueueWeaponSweep(
+            this,  // The weapon receiving the hits.
+            HitRegistry.GetSwingId(),  // The swing the trace belongs to.
+            Start,  // Start position of the trace (base of the blade).
+            End,  // End position of the trace (tip of the blade).
+            BoxTraceStart->GetComponentQuat(),  // Orientation of the box (matches the start component’s rotation).
+            FCollisionShape::MakeBox(FVector(5.f, 5.f, 5.f)),  // Box half-size (5 units in each dimension for a small box).
+            HitRegistry.GetQueryParams()  // Reused query params ignoring the weapon and its wielder.
+        );
+    }
+}
@@ -6,6 +6,69 @@
 #include "Kismet/GameplayStatics.h"
 #include "Components/AudioComponent.h"
 
+namespace
+{
+    /// Sound parameters of one attack section.
+    struct FAEOA_SwingSoundSection
+    {
+        FName SectionName;
+        float StartPan;
+        float EndPan;
+        float Duration;
+        float PitchShift;
+    };
+
+    // Right-to-left swing (Attack1): pan from left to right over 2.4 seconds, pitch 1.261979 / 2.4.
+    // Left-to-right swing (Attack2): pan from right to left over 3.166667 seconds, pitch 1.261979 / 3.166667.
+    const FAEOA_SwingSoundSection SwingSoundSections[] =
+    {
+        { FName("Attack1"), -1.0f, 1.0f, 2.4f, 0.525824f },
+        { FName("Attack2"), 1.0f, -1.0f, 3.166667f, 0.398523f },
+    };
+
+    // MetaSound input names, built once at module load.
+    const FName StartPanParameterName("StartPan");
+    const FName EndPanParameterName("EndPan");
+    const FName DurationParameterName("Duration");
+    const FName PitchShiftParameterName("Pitch Shift");
+}
+
+// --- PostLoad ---
+void UAnimNotifyState_PlayMetaSound::PostLoad()
+{
+    Super::PostLoad();
+
+    BuildSwingParameters();
+}
+
+#if WITH_EDITOR
+// --- PostEditChangeProperty ---
+void UAnimNotifyState_PlayMetaSound::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    BuildSwingParameters();
+}
+#endif
+
+// --- BuildSwingParameters ---
+// Sections without swing data (e.g., Attack3) play the sound with the MetaSound’s default parameters.
+void UAnimNotifyState_PlayMetaSound::BuildSwingParameters()
+{
+    SwingParameters.Reset();
+
+    for (const FAEOA_SwingSoundSection& Section : SwingSoundSections)
+    {
+        if (Section.SectionName != SectionName) continue;
+
+        SwingParameters.Emplace(StartPanParameterName, Section.StartPan);
+        SwingParameters.Emplace(EndPanParameterName, Section.EndPan);
+        SwingParameters.Emplace(DurationParameterName, Section.Duration);
+        SwingParameters.Emplace(PitchShiftParameterName, Section.PitchShift);
+        break;
+    }
+}
+
 // --- Notify Begin ---
 // Called when the notify state begins, plays the SFX_Woosh MetaSound with appropriate parameters.
 void UAnimNotifyState_PlayMetaSound::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
@@ -26,32 +89,20 @@ void UAnimNotifyState_PlayMetaSound::NotifyBegin(USkeletalMeshComponent* MeshCom
             Location,
             FRotator::ZeroRotator,
             1.0f, // Volume multiplier.
-            1.0f, // Pitch multiplier (handled by SetFloatParameter).
+            1.0f, // Pitch multiplier (handled by the Pitch Shift parameter).
             0.0f, // Start time.
             nullptr, // Attenuation settings (default).
             nullptr, // Concurrency settings (default).
             true // Auto-destroy after playback (one-shot sound).
         );
 
-        if (AudioComponent)
+        if (AudioComponent && SwingParameters.Num() > 0)
         {
-            // Set parameters for duration, panning direction, and pitch shift.
-            if (SectionName == FName("Attack1"))
-            {
-                // Right-to-left swing: Pan from left to right, 2.4 seconds.
-                AudioComponent->SetFloatParameter(FName("StartPan"), -1.0f); // Start on the left.
-                AudioComponent->SetFloatParameter(FName("EndPan"), 1.0f);   // End on the right.
-                AudioComponent->SetFloatParameter(FName("Duration"), 2.4f);
-                AudioComponent->SetFloatParameter(FName("Pitch Shift"), 0.525824f); // 1.261979 / 2.4.
-            }
-            else if (SectionName == FName("Attack2"))
-            {
-                // Left-to-right swing: Pan from right to left, 3.166667 seconds.
-                AudioComponent->SetFloatParameter(FName("StartPan"), 1.0f);  // Start on the right.
-                AudioComponent->SetFloatParameter(FName("EndPan"), -1.0f);  // End on the left.
-                AudioComponent->SetFloatParameter(FName("Duration"), 3.166667f);
-                AudioComponent->SetFloatParameter(FName("Pitch Shift"), 0.398523f); // 1.261979 / 3.166667.
-            }
+            // Send the precomputed duration, panning direction, and pitch shift parameters in one call.
+            // SetParameters takes ownership of a default-allocated TArray and moves it to the audio thread,
+            // so an inline-allocated copy cannot be passed; the one exact-size copy per swing replaces the
+            // four single-parameter commands (each allocating its own array) sent before.
+            AudioComponent->SetParameters(CopyTemp(SwingParameters));
         }
     }
 }
@@ -62,4 +113,4 @@ void UAnimNotifyState_PlayMetaSound::NotifyEnd(USkeletalMeshComponent* MeshComp,
 {
     Super::NotifyEnd(MeshComp, Animation, EventReference);
     // Sound playback is handled by SpawnSoundAtLocation, which auto-destroys, so no cleanup needed.
-}
\ No newline at end of file
+}
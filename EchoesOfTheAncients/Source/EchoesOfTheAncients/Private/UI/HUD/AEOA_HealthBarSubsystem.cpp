@@ -0,0 +1,175 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the UAEOA_HealthBarSubsystem class, projecting the visible
+// health bars once per frame for the batched viewport layer.
+
+#include "UI/HUD/AEOA_HealthBarSubsystem.h"
+#include "EchoesOfTheAncients/AEOA_Stats.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_CYCLE_STAT(TEXT("Health Bar Projection"), STAT_AEOA_HealthBarProjection, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Health Bar Slots"), STAT_AEOA_HealthBarSlots, STATGROUP_EchoesOfTheAncients);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Health Bars Drawn"), STAT_AEOA_HealthBarsDrawn, STATGROUP_EchoesOfTheAncients);
+
+static TAutoConsoleVariable<float> CVarHealthBarsWidth(
+	TEXT("AEOA.HealthBars.Width"),
+	80.f,
+	TEXT("Width of an enemy health bar, in viewport pixels."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarHealthBarsHeight(
+	TEXT("AEOA.HealthBars.Height"),
+	8.f,
+	TEXT("Height of an enemy health bar, in viewport pixels."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarHealthBarsMaxDistance(
+	TEXT("AEOA.HealthBars.MaxDistance"),
+	4000.f,
+	TEXT("Visible health bars farther than this distance from the camera are not drawn, in Unreal units."),
+	ECVF_Default);
+
+// --- DoesSupportWorldType ---
+bool UAEOA_HealthBarSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// --- OnWorldBeginPlay ---
+void UAEOA_HealthBarSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UGameViewportClient* GameViewport = InWorld.GetGameViewport())
+	{
+		Layer = SNew(SAEOA_HealthBarLayer);
+		GameViewport->AddViewportWidgetContent(Layer.ToSharedRef());
+	}
+}
+
+// --- Deinitialize ---
+void UAEOA_HealthBarSubsystem::Deinitialize()
+{
+	if (Layer.IsValid())
+	{
+		if (UGameViewportClient* GameViewport = GetWorld()->GetGameViewport())
+		{
+			GameViewport->RemoveViewportWidgetContent(Layer.ToSharedRef());
+		}
+		Layer.Reset();
+	}
+
+	Owners.Empty();
+	Offsets.Empty();
+	Percents.Empty();
+	Visible.Empty();
+	FreeSlots.Empty();
+	DrawItems.Empty();
+
+	Super::Deinitialize();
+}
+
+// --- GetStatId ---
+TStatId UAEOA_HealthBarSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAEOA_HealthBarSubsystem, STATGROUP_Tickables);
+}
+
+// --- AllocateBar ---
+int32 UAEOA_HealthBarSubsystem::AllocateBar(AActor* Owner, const FVector& Offset)
+{
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = Owners.AddDefaulted();
+		Offsets.AddDefaulted();
+		Percents.AddDefaulted();
+		Visible.AddDefaulted();
+	}
+
+	Owners[Slot] = Owner;
+	Offsets[Slot] = Offset;
+	Percents[Slot] = 1.f;
+	Visible[Slot] = false;
+	return Slot;
+}
+
+// --- ReleaseBar ---
+void UAEOA_HealthBarSubsystem::ReleaseBar(int32 Slot)
+{
+	if (!Owners.IsValidIndex(Slot) || !Owners[Slot]) return;
+
+	Owners[Slot] = nullptr;
+	Visible[Slot] = false;
+	FreeSlots.Add(Slot);
+}
+
+// --- SetBarVisible ---
+void UAEOA_HealthBarSubsystem::SetBarVisible(int32 Slot, bool bVisible)
+{
+	if (Visible.IsValidIndex(Slot))
+	{
+		Visible[Slot] = bVisible;
+	}
+}
+
+// --- SetBarPercent ---
+void UAEOA_HealthBarSubsystem::SetBarPercent(int32 Slot, float Percent)
+{
+	if (Percents.IsValidIndex(Slot))
+	{
+		Percents[Slot] = FMath::Clamp(Percent, 0.f, 1.f);
+	}
+}
+
+// --- Tick ---
+// Projection runs once for all bars; bars behind the camera, off screen or too far are left out.
+void UAEOA_HealthBarSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AEOA_HealthBarProjection);
+
+	DrawItems.Reset();
+
+	APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+	if (Layer.IsValid() && PlayerController && PlayerController->PlayerCameraManager)
+	{
+		const FVector CameraLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+		const float MaxDistanceSquared = FMath::Square(CVarHealthBarsMaxDistance.GetValueOnGameThread());
+
+		int32 ViewportWidth = 0;
+		int32 ViewportHeight = 0;
+		PlayerController->GetViewportSize(ViewportWidth, ViewportHeight);
+
+		for (int32 Slot = 0; Slot < Owners.Num(); ++Slot)
+		{
+			const AActor* Owner = Owners[Slot];
+			if (!Visible[Slot] || !IsValid(Owner)) continue;
+
+			const FVector WorldLocation = Owner->GetActorLocation() + Offsets[Slot];
+			if (FVector::DistSquared(CameraLocation, WorldLocation) > MaxDistanceSquared) continue;
+
+			FVector2D ScreenPosition;
+			if (!PlayerController->ProjectWorldLocationToScreen(WorldLocation, ScreenPosition)) continue;
+			if (ScreenPosition.X < 0.0 || ScreenPosition.Y < 0.0 || ScreenPosition.X > ViewportWidth || ScreenPosition.Y > ViewportHeight) continue;
+
+			FAEOA_HealthBarDrawItem& DrawItem = DrawItems.AddDefaulted_GetRef();
+			DrawItem.ScreenPosition = FVector2f(ScreenPosition);
+			DrawItem.Percent = Percents[Slot];
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AEOA_HealthBarsDrawn, DrawItems.Num());
+	if (Layer.IsValid())
+	{
+		Layer->SwapBars(DrawItems, FVector2f(CVarHealthBarsWidth.GetValueOnGameThread(), CVarHealthBarsHeight.GetValueOnGameThread()));
+	}
+
+	SET_DWORD_STAT(STAT_AEOA_HealthBarSlots, Owners.Num() - FreeSlots.Num());
+}
@@ -0,0 +1,60 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Implements the SAEOA_HealthBarLayer class, painting
+// every visible enemy health bar in a single pass.
+
+#include "UI/HUD/SAEOA_HealthBarLayer.h"
+#include "Rendering/DrawElements.h"
+
+namespace
+{
+	const FLinearColor HealthBarBackgroundColor(0.f, 0.f, 0.f, 0.6f);
+	const FLinearColor HealthBarFillColor(0.75f, 0.05f, 0.03f, 1.f);
+}
+
+// --- Construct ---
+void SAEOA_HealthBarLayer::Construct(const FArguments& InArgs)
+{
+	SetVisibility(EVisibility::HitTestInvisible);
+}
+
+// --- SwapBars ---
+void SAEOA_HealthBarLayer::SwapBars(TArray<FAEOA_HealthBarDrawItem>& InBars, const FVector2f& InBarSize)
+{
+	Swap(Bars, InBars);
+	BarSize = InBarSize;
+}
+
+// --- ComputeDesiredSize ---
+FVector2D SAEOA_HealthBarLayer::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D::ZeroVector;
+}
+
+// --- OnPaint ---
+// Bars are projected in viewport pixels; dividing by the geometry scale converts them to the layer's
+// DPI-scaled local space. All backgrounds share one layer and all fills the next, so they batch.
+int32 SAEOA_HealthBarLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	if (Bars.IsEmpty()) return LayerId;
+
+	const float InverseScale = 1.f / AllottedGeometry.Scale;
+	const FVector2f LocalBarSize = BarSize * InverseScale;
+	const FVector2f HalfBarSize = LocalBarSize * 0.5f;
+
+	for (const FAEOA_HealthBarDrawItem& Bar : Bars)
+	{
+		const FVector2f TopLeft = Bar.ScreenPosition * InverseScale - HalfBarSize;
+
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+			AllottedGeometry.ToPaintGeometry(LocalBarSize, FSlateLayoutTransform(TopLeft)),
+			&Brush, ESlateDrawEffect::None, HealthBarBackgroundColor * InWidgetStyle.GetColorAndOpacityTint());
+
+		if (Bar.Percent > 0.f)
+		{
+			FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 1,
+				AllottedGeometry.ToPaintGeometry(FVector2f(LocalBarSize.X * Bar.Percent, LocalBarSize.Y), FSlateLayoutTransform(TopLeft)),
+				&Brush, ESlateDrawEffect::None, HealthBarFillColor * InWidgetStyle.GetColorAndOpacityTint());
+		}
+	}
+	return LayerId + 1;
+}
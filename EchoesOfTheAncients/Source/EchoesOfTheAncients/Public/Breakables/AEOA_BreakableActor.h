@@ -8,9 +8,12 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Interfaces/HitInterface.h"
+#include "Items/AEOA_LootTypes.h"
 #include "AEOA_BreakableActor.generated.h"
 
+class AAEOA_CoinBurst;
 class AEOA_Treasure;
+class UAEOA_HurtboxComponent;
 class UCapsuleComponent;
 class UGeometryCollectionComponent;
 
@@ -30,21 +33,55 @@ public:
 	// Handles the reaction when the actor is hit by a weapon
 	virtual void GetHit_Implementation(const FVector& ImpactPoint) override;
 
+	/// Migrates the deprecated hard treasure and coin burst references into LootTable.
+	virtual void PostLoad() override;
+
 protected:
 	
+	/// Called when the game starts or when spawned, registers the loot table for asynchronous preloading and the actor with the hittable grid.
 	virtual void BeginPlay() override;
 
+	/// Called when the actor is removed from the world, stops streaming its loot and leaves the hittable grid.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite)
 	UGeometryCollectionComponent* GeometryCollection;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite)
 	UCapsuleComponent* Capsule;
+
+	/// Shape weapons hit to break the actor, matching Capsule unless shapes are set.
+	UPROPERTY(VisibleAnywhere)
+	UAEOA_HurtboxComponent* Hurtbox;
 	
 private:
 
+	/// Loot dropped when the actor is broken: every guaranteed entry, plus one entry rolled by weight.
+	UPROPERTY(EditAnywhere, Category = "Breakable Properties",
+		meta = (ToolTip = "Loot dropped when the actor is broken (e.g., BP_Coin, BP_CoinBurst). Classes are soft references, loaded asynchronously when the player gets close."))
+	TArray<FAEOA_LootEntry> LootTable;
+
+	/// Height above the actor’s origin at which loot spawns.
 	UPROPERTY(EditAnywhere, Category = "Breakable Properties",
-		meta = (ToolTip = "Treasure class to spawn when the actor is broken, set in the default Blueprint (e.g., BP_Coin)."))
-	TSubclassOf<class AAEOA_Treasure> TreasureClass;
+		meta = (ToolTip = "Height above the actor’s origin at which loot spawns, in Unreal units."))
+	float LootSpawnHeight = 75.f;
+
+	/// Replaced by LootTable, which references the class softly; migrated in PostLoad.
+	UPROPERTY()
+	TSubclassOf<class AAEOA_Treasure> TreasureClass_DEPRECATED;
+
+	/// Replaced by a guaranteed LootTable entry; migrated in PostLoad.
+	UPROPERTY()
+	TSubclassOf<AAEOA_CoinBurst> CoinBurstClass_DEPRECATED;
+
+	/// Moves a deprecated loot class into LootTable without duplicating an entry.
+	/// @param OldClass The class referenced by the deprecated property.
+	/// @param bGuaranteed Whether the entry always drops (the coin burst) or is rolled (the treasure).
+	void MigrateLootClass(UClass* OldClass, bool bGuaranteed);
+
+	/// Rolls one of the weighted LootTable entries.
+	/// @return const FAEOA_LootEntry* The rolled entry, or nullptr if no entry has a positive weight.
+	const FAEOA_LootEntry* RollWeightedLoot() const;
 
 	/// Tracks whether the actor has already been broken, preventing multiple GetHit calls.
 	bool bBroken = false;
@@ -0,0 +1,63 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the FAEOA_MontageSectionTable struct, resolving the sections a
+// character plays from a montage once, so hot paths start them by entry.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UAnimInstance;
+class UAnimMontage;
+
+/**
+ * Section indices and start times of a montage, resolved from a fixed list of section names.
+ * Entry N is the Nth name of the list, so callers map their own data (death pose, hit direction)
+ * to entries and start a section without constructing, hashing or searching a section name.
+ * The name list must outlive the table, typically a static array in the owner’s translation unit.
+ */
+struct ECHOESOFTHEANCIENTS_API FAEOA_MontageSectionTable
+{
+	/// Creates an empty table. Tables are members of UCLASSes, whose generated constructors need a default one.
+	FAEOA_MontageSectionTable() = default;
+
+	/// Sets the section names of the table, resolved on Build or on the first Play. Called from the owner’s constructor.
+	/// @param InSectionNames Section names, one per entry, with static storage.
+	void Init(TConstArrayView<FName> InSectionNames);
+
+	/// Resolves every entry against the montage. Entries missing from the montage resolve to INDEX_NONE, with a warning.
+	/// @param InMontage The montage to resolve, or nullptr to clear the table.
+	void Build(const UAnimMontage* InMontage);
+
+	/// Plays the montage starting at the section of the entry, resolving the table first if it was built for another montage.
+	/// A section missing from the montage plays the montage from its start, as Montage_JumpToSection did.
+	/// @param AnimInstance The anim instance playing the montage.
+	/// @param InMontage The montage to play.
+	/// @param Entry Index into the section names.
+	/// @param PlayRate Play rate of the montage.
+	/// @return bool True if the montage started.
+	bool Play(UAnimInstance* AnimInstance, UAnimMontage* InMontage, int32 Entry, float PlayRate = 1.f);
+
+	/// Gets the montage section index of an entry.
+	/// @param Entry Index into the section names.
+	/// @return int32 The section index, or INDEX_NONE if the montage has no such section.
+	int32 GetSectionIndex(int32 Entry) const { return SectionIndices.IsValidIndex(Entry) ? SectionIndices[Entry] : INDEX_NONE; }
+
+	/// Gets the number of entries.
+	/// @return int32 The number of section names.
+	int32 Num() const { return SectionNames.Num(); }
+
+private:
+
+	/// Section names, one per entry.
+	TConstArrayView<FName> SectionNames;
+
+	/// Montage the table was resolved for.
+	FObjectKey Montage;
+
+	/// Montage section index of each entry.
+	TArray<int32, TInlineAllocator<8>> SectionIndices;
+
+	/// Start time of each entry’s section within the montage.
+	TArray<float, TInlineAllocator<8>> StartTimes;
+};
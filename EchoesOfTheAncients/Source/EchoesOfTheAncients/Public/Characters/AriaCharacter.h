@@ -5,6 +5,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Characters/AEOA_MontageSectionTable.h"
 #include "Characters/CharacterTypes.h"
 #include "GameFramework/Character.h"
 #include "AriaCharacter.generated.h"
@@ -37,8 +38,8 @@ public:
 	/// Called to bind functionality to input.
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
-	/// Sets the collision enabled state for the equipped weapon’s WeaponBox.
-	/// @param CollisionEnabled The collision state to set (e.g., NoCollision, QueryOnly).
+	/// Opens or closes the collision window of the equipped weapon.
+	/// @param CollisionEnabled The collision state to set (e.g., NoCollision closes the window, QueryOnly opens it).
 	UFUNCTION(BlueprintCallable)
 	void SetWeaponCollisionEnabled(ECollisionEnabled::Type CollisionEnabled);
 
@@ -68,6 +69,10 @@ protected:
 	/// Callback for the 'E' key press to equip a item.
 	void PickupItem();
 
+	/// Queries UAEOA_PickupGridSubsystem for pickups within reach, lets each candidate react to the contact,
+	/// and keeps the best remaining one as OverlappingItem for PickupItem.
+	void UpdatePickupCandidates();
+
 	/// Callback for the left mouse button press to play an attack montage.
 	void Attack_OneHanded();
 
@@ -103,8 +108,14 @@ protected:
 	void PlayAttackMontage_OneHandedWeapon();
 
 	/// Plays the equip/unequip montage with the specified section.
-	/// @param SectionName The name of the section to play (e.g., "Equip" or "Unequip").
-	void PlayEquipMontage(const FName& SectionName);
+	/// @param bEquip True to play the "Equip" section, false to play the "UnEquip" section.
+	void PlayEquipMontage(bool bEquip);
+
+	/// One-handed attack sections (Attack1 to Attack3), resolved once against Attack_OneHandedWeapon.
+	FAEOA_MontageSectionTable AttackSections;
+
+	/// Equip sections (Equip, UnEquip), resolved once against EquipMontage.
+	FAEOA_MontageSectionTable EquipSections;
 
 	/**
 	 * Input Mapping
@@ -171,10 +182,18 @@ private:
 		meta = (ToolTip = "Groom component for Aria’s eyebrows, attached to the head socket of the Echo mesh."))
 	UGroomComponent* Eyebrows;
 
-	/// Pointer to the item Aria is currently overlapping with, if any.
+	/// Pointer to the best item within Aria’s reach, if any, refreshed every frame from the pickup grid.
 	UPROPERTY(VisibleInstanceOnly)
 	AAEOA_Item* OverlappingItem;
 
+	/// Maximum number of pickups considered per frame, best ranked first.
+	UPROPERTY(EditAnywhere, Category = "Aria|Pickup",
+		meta = (ClampMin = "1", ClampMax = "8", ToolTip = "Maximum number of pickups within reach handled per frame, ranked by distance and facing."))
+	int32 MaxPickupCandidates = 4;
+
+	/// Scratch buffer receiving the pickup grid query results each frame.
+	TArray<AAEOA_Item*, TInlineAllocator<4>> PickupCandidates;
+
 	/// Tracks Aria’s current state (e.g., unequipped or equipped with a weapon).
 	ECharacterState CharacterState = ECharacterState::ECS_Unequipped;
 
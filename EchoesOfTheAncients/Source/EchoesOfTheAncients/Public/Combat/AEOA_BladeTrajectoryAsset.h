@@ -0,0 +1,91 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_BladeTrajectoryAsset class, an editor-baked cache of the
+// weapon socket path through each section of an attack montage, sampled at
+// runtime instead of reading the animated blade components.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "AEOA_BladeTrajectoryAsset.generated.h"
+
+class UAnimMontage;
+class USkeletalMesh;
+
+/// Weapon socket path through one montage section, sampled at a fixed interval in skeletal mesh component space.
+USTRUCT()
+struct FAEOA_BladeTrajectorySection
+{
+	GENERATED_BODY()
+
+	/// Name of the montage section (e.g., Attack1).
+	UPROPERTY(VisibleAnywhere, Category = "Trajectory")
+	FName SectionName;
+
+	/// Montage position of the first sample, in seconds.
+	UPROPERTY(VisibleAnywhere, Category = "Trajectory")
+	float StartTime = 0.f;
+
+	/// Time between two samples, in seconds.
+	UPROPERTY(VisibleAnywhere, Category = "Trajectory")
+	float SampleInterval = 0.f;
+
+	/// Socket location of every sample.
+	UPROPERTY(VisibleAnywhere, Category = "Trajectory")
+	TArray<FVector3f> Locations;
+
+	/// Socket rotation of every sample.
+	UPROPERTY(VisibleAnywhere, Category = "Trajectory")
+	TArray<FQuat4f> Rotations;
+};
+
+/**
+ * Baked weapon socket trajectories of an attack montage.
+ * The blade path of a combo section is fixed relative to the character, so it is sampled once in the editor;
+ * at runtime weapons rebuild their blade from the montage position and the mesh transform,
+ * without waiting for, or forcing, a pose evaluation of the wielder.
+ */
+UCLASS(BlueprintType)
+class ECHOESOFTHEANCIENTS_API UAEOA_BladeTrajectoryAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Montage whose sections are baked, e.g., AM_Attack_OneHanded.
+	UPROPERTY(EditAnywhere, Category = "Bake",
+		meta = (ToolTip = "Attack montage whose sections are baked (e.g., AM_Attack_OneHanded). Weapons only use the cache while this montage plays."))
+	TObjectPtr<UAnimMontage> Montage;
+
+	/// Socket the weapon is attached to.
+	UPROPERTY(EditAnywhere, Category = "Bake",
+		meta = (ToolTip = "Socket the weapon is attached to during the attack (e.g., R_hand_weapon)."))
+	FName SocketName = FName("R_hand_weapon");
+
+	/// Number of samples baked per second of montage.
+	UPROPERTY(EditAnywhere, Category = "Bake",
+		meta = (ClampMin = "10.0", ClampMax = "240.0", ToolTip = "Samples baked per second of montage. 60 keeps the interpolated blade within a few units of the animation."))
+	float SampleRate = 60.f;
+
+	/// Mesh providing the socket when it is defined on the mesh rather than the skeleton.
+	UPROPERTY(EditAnywhere, Category = "Bake",
+		meta = (ToolTip = "Skeletal mesh used for the bake, required when the socket is defined on the mesh instead of the skeleton."))
+	TSoftObjectPtr<USkeletalMesh> BakeMesh;
+
+	/// Baked trajectory of every montage section.
+	UPROPERTY(VisibleAnywhere, Category = "Trajectory")
+	TArray<FAEOA_BladeTrajectorySection> Sections;
+
+#if WITH_EDITOR
+	/// Samples the socket through every section of the montage, replacing the baked sections.
+	UFUNCTION(CallInEditor, Category = "Bake")
+	void Bake();
+#endif
+
+	/// Interpolates the socket transform of a section at the given montage position.
+	/// @param SectionName The montage section playing.
+	/// @param Position The montage position, in seconds.
+	/// @param OutSocketTransform The socket transform in skeletal mesh component space.
+	/// @return bool True if the section is baked.
+	bool SampleSocket(FName SectionName, float Position, FTransform& OutSocketTransform) const;
+};
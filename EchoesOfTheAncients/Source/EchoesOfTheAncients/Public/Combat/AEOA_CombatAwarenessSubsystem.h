@@ -0,0 +1,85 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_CombatAwarenessSubsystem class, a world subsystem that
+// tracks every engaged enemy–target pair and reports when targets enter or
+// leave combat range, so enemies do not poll distances in their own tick.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_CombatAwarenessSubsystem.generated.h"
+
+class AAEOA_Enemy;
+
+/// Broadcast when the target of an engaged enemy enters or leaves its combat radius.
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FAEOA_OnCombatRangeChanged, AAEOA_Enemy* /*Enemy*/, AActor* /*Target*/, bool /*bInRange*/);
+
+/**
+ * World subsystem holding the engaged enemy–target pairs in flat arrays.
+ * At the configured rate (AEOA.CombatAwareness.UpdateInterval), one pass compares squared distances
+ * against each pair's radius and reports range transitions to the enemy and to OnCombatRangeChanged.
+ * Enemies without a target are not in the arrays and cost nothing.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_CombatAwarenessSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Drops every pair when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Checks the pairs at the configured interval.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Starts tracking the distance between an enemy and its target, or updates the pair if the enemy is engaged.
+	/// The pair starts in range; a leave event follows once the target is farther than the radius.
+	/// @param Enemy The engaged enemy.
+	/// @param Target The enemy’s combat target (e.g., Aria).
+	/// @param Radius The combat radius of the enemy.
+	void Engage(AAEOA_Enemy* Enemy, AActor* Target, float Radius);
+
+	/// Stops tracking the enemy, e.g., when it dies or loses its target.
+	/// @param Enemy The enemy to disengage, ignored if it is not engaged.
+	void Disengage(AAEOA_Enemy* Enemy);
+
+	/// Gets the number of engaged pairs.
+	/// @return int32 The number of engaged enemies.
+	FORCEINLINE int32 GetNumEngaged() const { return Enemies.Num(); }
+
+	/// Broadcast on every range transition, after the enemy has been notified.
+	FAEOA_OnCombatRangeChanged OnCombatRangeChanged;
+
+private:
+
+	/// Compares every pair's squared distance against its radius and reports transitions.
+	void UpdatePairs();
+
+	/// Engaged enemies, indexed in parallel with the arrays below.
+	UPROPERTY()
+	TArray<AAEOA_Enemy*> Enemies;
+
+	/// Combat target of each enemy.
+	UPROPERTY()
+	TArray<AActor*> Targets;
+
+	/// Squared combat radius of each pair.
+	TArray<float> RadiiSquared;
+
+	/// Whether each target was in range at the last check.
+	TArray<bool> InRange;
+
+	/// Range transitions found by the last check, reported once the pass is over.
+	TArray<TPair<TWeakObjectPtr<AAEOA_Enemy>, bool>> Transitions;
+
+	/// Time accumulated since the last check.
+	float TimeSinceUpdate = 0.f;
+};
@@ -0,0 +1,120 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_CombatLatencySubsystem class, a world subsystem that
+// timestamps each stage of an attack, from the input press to the damage,
+// and collects the delays between stages into latency histograms.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/Histogram.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AEOA_CombatLatencySubsystem.generated.h"
+
+/// Stages of an attack, in the order they are reached.
+enum class EAEOA_AttackStage : uint8
+{
+	/// The attack input was accepted (e.g., Aria’s Attack_OneHanded).
+	Input,
+
+	/// The attack montage started playing.
+	MontageStart,
+
+	/// The weapon’s collision window opened.
+	CollisionOpen,
+
+	/// The first hit of the attack was resolved and its damage applied.
+	Impact,
+
+	MAX
+};
+
+/**
+ * World subsystem measuring input-to-impact latency of attacks.
+ * Each attacker has one attack in flight: Input starts it, and every later stage is
+ * recorded once, only if the previous stage was reached. The first Impact completes
+ * the attack and adds the delay of each interval (input to montage, montage to
+ * collision window, collision window to damage, and input to damage) to a histogram,
+ * in milliseconds and in frames. The last delays are published as stats and trace
+ * counters, stage bookmarks are emitted on the AEOA_CombatLatency trace channel, and
+ * AEOA.CombatLatency.Dump writes the histograms to the log.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_CombatLatencySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Sets up the histograms.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/// Drops the attacks in flight.
+	virtual void Deinitialize() override;
+
+	/// Records that an attacker reached a stage of its current attack.
+	/// Input starts a new attack; other stages are ignored when out of order or already recorded.
+	/// @param Attacker The actor performing the attack (e.g., Aria, the owner of the weapon).
+	/// @param Stage The stage reached.
+	void MarkStage(const AActor* Attacker, EAEOA_AttackStage Stage);
+
+	/// Writes the histogram and the frame delays of every interval to the log.
+	void DumpReport();
+
+	/// Clears the histograms and counters, e.g., before profiling a specific encounter.
+	void ResetMeasurements();
+
+private:
+
+	/// Intervals measured between stages of an attack.
+	enum EInterval : int32
+	{
+		InputToMontage,
+		MontageToCollision,
+		CollisionToImpact,
+		InputToImpact,
+		NumIntervals
+	};
+
+	static constexpr int32 NumStages = static_cast<int32>(EAEOA_AttackStage::MAX);
+
+	/// Timestamps of the attack in flight of one attacker.
+	struct FAttackTimeline
+	{
+		double Seconds[NumStages] = {};
+		uint64 Frames[NumStages] = {};
+		uint32 AttackId = 0;
+
+		/// Index of the next stage expected, NumStages once the attack landed.
+		int32 NextStage = NumStages;
+	};
+
+	/// Frame delays of an interval, alongside its millisecond histogram.
+	struct FFrameDelays
+	{
+		uint64 Total = 0;
+		uint64 Max = 0;
+	};
+
+	/// Adds the intervals of a landed attack to the histograms, stats and trace counters.
+	void RecordLandedAttack(const FAttackTimeline& Timeline);
+
+	/// Attack in flight per attacker.
+	TMap<TObjectKey<AActor>, FAttackTimeline> Timelines;
+
+	/// Millisecond delays of each interval.
+	FHistogram Histograms[NumIntervals];
+
+	/// Frame delays of each interval.
+	FFrameDelays FrameDelays[NumIntervals];
+
+	/// Attacks started and attacks that landed since the last reset.
+	int32 NumAttacksStarted = 0;
+	int32 NumAttacksLanded = 0;
+
+	/// Id given to the next attack, used to match trace bookmarks.
+	uint32 NextAttackId = 1;
+};
@@ -0,0 +1,77 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_CombatResolutionSubsystem class, the single stage where
+// the hits collected during a frame are resolved: damage, hit reactions
+// (with their audio and particles) and Field System fields.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_CombatResolutionSubsystem.generated.h"
+
+class AAEOA_Weapon;
+class AController;
+
+/// A weapon hit waiting to be resolved.
+struct FAEOA_HitRecord
+{
+	/// Controller credited with the damage (e.g., Aria’s controller).
+	TWeakObjectPtr<AController> Attacker;
+
+	/// Actor struck by the weapon.
+	TWeakObjectPtr<AActor> Victim;
+
+	/// Weapon that landed the hit.
+	TWeakObjectPtr<AAEOA_Weapon> Weapon;
+
+	/// World location of the impact.
+	FVector ImpactPoint = FVector::ZeroVector;
+
+	/// Damage carried by the hit.
+	float Damage = 0.f;
+
+	/// Swing of the weapon the hit belongs to.
+	int32 SwingId = 0;
+};
+
+/**
+ * World subsystem resolving weapon hits once per frame, after every actor has ticked.
+ * Records are grouped by victim and deduplicated per weapon swing, then resolved in phases:
+ * all damage first, then one hit reaction per victim, then the weapon fields.
+ * Nothing runs inside physics or overlap callbacks, so Die() disabling collision cannot re-enter a trace.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_CombatResolutionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Drops unresolved hits when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Resolves the hits queued during the frame.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Queues a hit for resolution at the end of the frame.
+	/// @param Record The hit to resolve.
+	void QueueHit(const FAEOA_HitRecord& Record);
+
+private:
+
+	/// Groups, deduplicates and resolves the queued hits.
+	void ResolveHits();
+
+	/// Hits queued during the frame.
+	TArray<FAEOA_HitRecord> QueuedHits;
+
+	/// Hits being resolved, swapped with QueuedHits so reactions can queue hits for the next frame.
+	TArray<FAEOA_HitRecord> ResolvingHits;
+};
@@ -0,0 +1,77 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_CombatTraceSubsystem class, a world subsystem that runs
+// weapon sweeps through the engine's async trace API and hands the hits back
+// to the weapons at the start of the next frame.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "AEOA_CombatTraceSubsystem.generated.h"
+
+class AAEOA_Weapon;
+
+/**
+ * World subsystem owning every weapon trace of the frame.
+ * Sweeps only look for hurtbox shapes (ECC_AEOA_Hurtbox).
+ * In async mode sweeps are queued with AsyncSweepByObjectType, overlap with the rest of the frame,
+ * and are resolved in request order before actors tick on the next frame.
+ * In sync mode (AEOA.CombatTrace.Async 0) the sweep runs immediately, for comparison.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_CombatTraceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Hooks the resolution pass to the start of every world tick.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/// Unhooks the resolution pass and drops pending sweeps.
+	virtual void Deinitialize() override;
+
+	/// Sweeps a shape for a weapon, reporting every hurtbox shape overlapped sorted by time.
+	/// The hits reach the weapon immediately in sync mode, or at the start of the next frame in async mode.
+	/// @param Weapon The weapon receiving the hits.
+	/// @param SwingId The weapon’s swing the sweep belongs to, late results of an older swing are dropped.
+	/// @param Start Start location of the sweep.
+	/// @param End End location of the sweep.
+	/// @param Rotation Orientation of the swept shape.
+	/// @param Shape The swept shape (e.g., a box spanning the blade).
+	/// @param QueryParams Query parameters, including the actors to ignore.
+	void QueueWeaponSweep(AAEOA_Weapon* Weapon, int32 SwingId, const FVector& Start, const FVector& End, const FQuat& Rotation, const FCollisionShape& Shape, const FCollisionQueryParams& QueryParams);
+
+private:
+
+	/// A sweep waiting for its async result.
+	struct FPendingSweep
+	{
+		FTraceHandle Handle;
+		TWeakObjectPtr<AAEOA_Weapon> Weapon;
+		int32 SwingId = 0;
+		double RequestTime = 0.0;
+	};
+
+	/// Resolves the sweeps queued on the previous frame, in request order, before actors tick.
+	void ResolvePendingSweeps(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/// Sweeps queued since the last resolution pass.
+	TArray<FPendingSweep> PendingSweeps;
+
+	/// Sweeps being resolved, swapped with PendingSweeps so weapons can queue new sweeps while receiving hits.
+	TArray<FPendingSweep> ResolvingSweeps;
+
+	/// Scratch buffer reused by synchronous sweeps.
+	TArray<FHitResult> SyncHits;
+
+	/// Number of sweeps issued since the last resolution pass.
+	int32 NumSweepsThisFrame = 0;
+
+	/// Handle of the OnWorldPreActorTick binding.
+	FDelegateHandle PreActorTickHandle;
+};
@@ -0,0 +1,74 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_FieldApplicationSubsystem class, a world subsystem that
+// applies the Field System fields of weapon impacts natively, merging the
+// impacts of a frame and reusing a small pool of field system components.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_FieldApplicationSubsystem.generated.h"
+
+class UFieldSystemComponent;
+
+/**
+ * World subsystem breaking geometry collections (e.g., GC_WoodenCrate, the clay pots) where weapons hit.
+ * Impacts are queued during combat resolution and applied once per frame: nearby impacts merge into one field,
+ * and fields without a geometry collection in their radius are skipped before anything reaches the physics thread.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_FieldApplicationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Drops queued impacts and the pooled components when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Queues the field of an impact for the next ApplyQueuedFields.
+	/// @param Location World location of the impact.
+	/// @param Radius Radius of the field.
+	/// @param Strain External strain applied to clusters in the radius, breaking them.
+	/// @param Impulse Radial force pushing the broken pieces away from the impact.
+	/// @return bool False if native fields are disabled (AEOA.Fields.Native 0), the caller should use its Blueprint fields.
+	bool QueueImpact(const FVector& Location, float Radius, float Strain, float Impulse);
+
+	/// Merges the queued impacts and applies one strain and one radial force field per merged impact.
+	void ApplyQueuedFields();
+
+private:
+
+	/// A queued impact, or several merged ones.
+	struct FFieldImpact
+	{
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.f;
+		float Strain = 0.f;
+		float Impulse = 0.f;
+		int32 NumMerged = 1;
+	};
+
+	/// Returns whether a geometry collection overlaps the sphere.
+	bool HasGeometryCollectionInRange(const FVector& Location, float Radius) const;
+
+	/// Creates the pooled components, once.
+	void EnsurePool();
+
+	/// Impacts queued since the last application.
+	TArray<FFieldImpact> QueuedImpacts;
+
+	/// Owner of the pooled components.
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> PoolOwner;
+
+	/// Pooled field system components, used round-robin.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UFieldSystemComponent>> FieldComponents;
+
+	/// Next pooled component to use.
+	int32 NextComponent = 0;
+};
@@ -0,0 +1,114 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_HittableGridSubsystem class, a world subsystem that keeps
+// the positions of hittable actors in a uniform grid and answers sphere, cone
+// and box queries for area attacks without touching the physics scene.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_HittableGridSubsystem.generated.h"
+
+/**
+ * World subsystem hashing IHitInterface actors (enemies, breakables) into a 2D grid of cells on the XY plane.
+ * Each actor is approximated by a bounding sphere. Static actors are hashed once; movable ones are
+ * re-hashed each frame only when they cross into another cell. A query visits the cells overlapped by
+ * its volume, so its cost depends on the area it covers rather than on the number of hittables in the level.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_HittableGridSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Reads the cell size once; changing it later only affects newly created worlds.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/// Releases every registered actor when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Re-hashes movable actors that changed cell.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Hashes the actor at its current location, using its simple collision cylinder as bounding sphere.
+	/// @param Actor The hittable actor to register, ignored if it is already registered.
+	/// @param bMovable Whether the actor moves (e.g., an enemy) and must be followed every frame.
+	void RegisterHittable(AActor* Actor, bool bMovable);
+
+	/// Removes the actor from the grid, e.g., when it dies or breaks.
+	/// @param Actor The actor to unregister, ignored if it is not registered.
+	void UnregisterHittable(AActor* Actor);
+
+	/// Finds the hittables whose bounding sphere intersects a sphere.
+	/// @param Center World center of the sphere.
+	/// @param Radius Radius of the sphere.
+	/// @param OutActors Receives the hittables found.
+	void QuerySphere(const FVector& Center, float Radius, TArray<AActor*>& OutActors) const;
+
+	/// Finds the hittables whose bounding sphere intersects a cone.
+	/// @param Origin World location of the cone apex (e.g., Aria’s location).
+	/// @param Direction Axis of the cone.
+	/// @param Length Length of the cone along its axis.
+	/// @param HalfAngleDegrees Half aperture of the cone, in degrees.
+	/// @param OutActors Receives the hittables found.
+	void QueryCone(const FVector& Origin, const FVector& Direction, float Length, float HalfAngleDegrees, TArray<AActor*>& OutActors) const;
+
+	/// Finds the hittables whose bounding sphere intersects an oriented box.
+	/// @param Center World center of the box.
+	/// @param Extent Half extents of the box.
+	/// @param Rotation Orientation of the box.
+	/// @param OutActors Receives the hittables found.
+	void QueryBox(const FVector& Center, const FVector& Extent, const FQuat& Rotation, TArray<AActor*>& OutActors) const;
+
+	/// Gets the number of actors currently hashed in the grid.
+	/// @return int32 The number of registered actors.
+	FORCEINLINE int32 GetNumHittables() const { return Actors.Num(); }
+
+private:
+
+	/// Computes the cell containing the given location.
+	FIntPoint GetCellKey(const FVector& Location) const;
+
+	/// Calls Test on every entry of the cells overlapped by the XY bounds, adding the actors it accepts.
+	template <typename TestType>
+	void GatherInBounds(const FVector& BoundsMin, const FVector& BoundsMax, TArray<AActor*>& OutActors, TestType&& Test) const;
+
+	/// Moves an entry from its cell to the given one.
+	void MoveToCell(int32 Index, const FIntPoint& CellKey);
+
+	/// Actors in the grid, indexed in parallel with the arrays below.
+	UPROPERTY()
+	TArray<AActor*> Actors;
+
+	/// World location of each actor when it was last hashed.
+	TArray<FVector> Locations;
+
+	/// Bounding sphere radius of each actor.
+	TArray<float> Radii;
+
+	/// Cell each actor is hashed into.
+	TArray<FIntPoint> CellKeys;
+
+	/// Whether each actor is followed every frame.
+	TArray<bool> Movable;
+
+	/// Slot of each registered actor.
+	TMap<TObjectKey<AActor>, int32> IndexByActor;
+
+	/// Actor slots contained in each non-empty cell.
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> Cells;
+
+	/// Edge length of a cell in Unreal units.
+	float CellSize = 400.f;
+
+	/// Largest bounding radius registered so far, widens the cells visited by a query.
+	float MaxRadius = 0.f;
+};
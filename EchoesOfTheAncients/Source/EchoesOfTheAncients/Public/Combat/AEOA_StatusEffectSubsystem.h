@@ -0,0 +1,126 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_StatusEffectSubsystem class, a world subsystem that
+// keeps every active status effect (bleed, burn, slow) in packed arrays
+// and steps them together at a fixed rate.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/AEOA_AttributeStoreSubsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_StatusEffectSubsystem.generated.h"
+
+class UAEOA_AttributeComponent;
+class UCharacterMovementComponent;
+
+/// Kinds of status effects, each stored in its own packed bucket.
+UENUM(BlueprintType)
+enum class EAEOA_StatusEffectType : uint8
+{
+	/// Damage per second; every application stacks as a separate effect.
+	ESE_Bleed UMETA(DisplayName = "Bleed"),
+
+	/// Damage per second; a new application refreshes the duration and keeps the stronger magnitude.
+	ESE_Burn UMETA(DisplayName = "Burn"),
+
+	/// Fraction of walk speed removed (0 to 1); a new application refreshes the duration and keeps the stronger magnitude.
+	ESE_Slow UMETA(DisplayName = "Slow"),
+
+	ESE_MAX UMETA(Hidden)
+};
+
+/// A status effect to apply, e.g., on each hit of a weapon.
+USTRUCT(BlueprintType)
+struct FAEOA_StatusEffectSpec
+{
+	GENERATED_BODY()
+
+	/// Kind of effect.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect",
+		meta = (ToolTip = "Kind of effect: Bleed and Burn deal damage per second, Slow reduces walk speed."))
+	EAEOA_StatusEffectType Type = EAEOA_StatusEffectType::ESE_Bleed;
+
+	/// Damage per second, or fraction of walk speed removed for slows.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect",
+		meta = (ClampMin = "0.0", ToolTip = "Damage per second for Bleed and Burn; fraction of walk speed removed (0 to 1) for Slow."))
+	float Magnitude = 5.f;
+
+	/// Seconds the effect lasts.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect",
+		meta = (ClampMin = "0.0", ToolTip = "Seconds the effect lasts."))
+	float Duration = 3.f;
+};
+
+/**
+ * World subsystem owning every active status effect.
+ * Each effect type keeps its effects in parallel arrays (target, magnitude, remaining time).
+ * At AEOA.StatusEffects.TickRate steps per second, one pass advances every effect: damage over time
+ * is summed per target and applied through one UAEOA_AttributeStoreSubsystem::ApplyBulkDamage call,
+ * and expired effects are swapped out of their arrays without reallocating.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_StatusEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Drops every effect when the world is torn down, restoring slowed walk speeds.
+	virtual void Deinitialize() override;
+
+	/// Runs the fixed-rate steps due this frame and publishes the effect stats.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Applies a status effect to an actor with an attribute component (and a character movement for slows).
+	/// @param Target The actor affected.
+	/// @param Spec The kind, magnitude and duration of the effect.
+	void ApplyEffect(AActor* Target, const FAEOA_StatusEffectSpec& Spec);
+
+	/// Removes every effect of an actor, e.g., when it dies or returns to a pool, restoring its walk speed.
+	/// @param Target The actor to clear.
+	void ClearEffects(AActor* Target);
+
+	/// Gets the number of active effects across every type.
+	/// @return int32 The number of effects.
+	int32 GetNumActiveEffects() const;
+
+private:
+
+	/// Effects of one type, in parallel arrays.
+	struct FEffectBucket
+	{
+		TArray<TWeakObjectPtr<UAEOA_AttributeComponent>> Targets;
+		TArray<int32> StoreHandles;
+		TArray<float> Magnitudes;
+		TArray<float> RemainingTimes;
+
+		/// Movement and unslowed walk speed of each target, used by slows only.
+		TArray<TWeakObjectPtr<UCharacterMovementComponent>> Movements;
+		TArray<float> BaseWalkSpeeds;
+
+		int32 Num() const { return Targets.Num(); }
+		void RemoveAtSwap(int32 Index);
+	};
+
+	/// Advances every effect by StepTime seconds.
+	void StepEffects(float StepTime);
+
+	/// Restores the walk speed of a slow before it is removed.
+	static void RestoreWalkSpeed(FEffectBucket& Bucket, int32 Index);
+
+	/// One bucket per effect type.
+	FEffectBucket Buckets[static_cast<int32>(EAEOA_StatusEffectType::ESE_MAX)];
+
+	/// Damage summed per target during a step, reused between steps.
+	TArray<FAEOA_AttributeDamage> DamageScratch;
+
+	/// Time accumulated toward the next step.
+	float StepAccumulator = 0.f;
+};
@@ -0,0 +1,54 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the FAEOA_SwingHitRegistry struct, the per-swing memory of a weapon:
+// which actors a swing already hit, and the collision query parameters its traces reuse.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionQueryParams.h"
+
+/**
+ * Swing-scoped hit registry owned by a weapon.
+ * Each collision window (one combo section) is a swing with its own id. Already-hit actors
+ * live in a small inline array, so registering hits and starting swings never allocates
+ * in the common case, and the query parameters are built once and reused by every trace.
+ */
+struct ECHOESOFTHEANCIENTS_API FAEOA_SwingHitRegistry
+{
+	/// Builds the reusable query parameters.
+	FAEOA_SwingHitRegistry();
+
+	/// Starts a new swing: bumps the swing id and forgets the hit actors without freeing memory.
+	/// @param Weapon The weapon swinging, ignored by the swing’s traces.
+	/// @param Wielder The actor holding the weapon, ignored by the swing’s traces.
+	void BeginSwing(const AActor* Weapon, const AActor* Wielder);
+
+	/// Records a hit on the actor for the current swing.
+	/// @param Actor The actor struck.
+	/// @return bool True if this is the first hit on the actor this swing, false if it was already hit.
+	bool RegisterHit(const AActor* Actor);
+
+	/// Checks whether the actor was already hit during the current swing.
+	/// @param Actor The actor to check.
+	/// @return bool True if the actor was already hit.
+	bool HasHit(const AActor* Actor) const { return HitActors.Contains(Actor); }
+
+	/// Gets the id of the current swing, used to drop late trace results of older swings.
+	/// @return int32 The current swing id.
+	FORCEINLINE int32 GetSwingId() const { return SwingId; }
+
+	/// Gets the query parameters shared by every trace of the current swing.
+	/// @return const FCollisionQueryParams& The reusable query parameters.
+	FORCEINLINE const FCollisionQueryParams& GetQueryParams() const { return QueryParams; }
+
+private:
+
+	/// Actors hit during the current swing, compared by identity only.
+	TArray<const AActor*, TInlineAllocator<16>> HitActors;
+
+	/// Query parameters ignoring the weapon and its wielder, rebuilt only when a swing starts.
+	FCollisionQueryParams QueryParams;
+
+	/// Id of the current swing.
+	int32 SwingId = 0;
+};
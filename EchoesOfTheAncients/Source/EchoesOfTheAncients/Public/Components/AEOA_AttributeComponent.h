@@ -1,13 +1,19 @@
 // Copyright © 2025 Kdean Games. All Rights Reserved
 // Defines the UAEOA_AttributeComponent class, a component for 
 // managing actor attributes like health in Echoes of the Ancients.
+// Live values are kept in UAEOA_AttributeStoreSubsystem; the component never ticks.
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Components/AEOA_AttributeStoreSubsystem.h"
 #include "AEOA_AttributeComponent.generated.h"
 
+class UAEOA_AttributeComponent;
+
+/// Broadcast when an attribute of the component actually changes value.
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FAEOA_OnAttributeChanged, UAEOA_AttributeComponent* /*Component*/, float /*OldValue*/, float /*NewValue*/);
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class ECHOESOFTHEANCIENTS_API UAEOA_AttributeComponent : public UActorComponent
@@ -18,21 +24,35 @@ public:
 	
 	UAEOA_AttributeComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	/// Checks if the actor is alive based on health.
 	/// @return True if health is greater than 0, false otherwise.
-	bool IsAlive();
+	bool IsAlive() const;
+
+	/// Broadcast when health changes, e.g., to update a health bar.
+	FAEOA_OnAttributeChanged OnHealthChanged;
+
+	/// Broadcast when stamina changes.
+	FAEOA_OnAttributeChanged OnStaminaChanged;
+
+	/// Called by UAEOA_AttributeStoreSubsystem when an attribute of the component changed, broadcasts the matching event.
+	/// @param Attribute The attribute that changed.
+	/// @param OldValue The value before the change.
+	/// @param NewValue The value after the change.
+	void HandleAttributeChanged(EAEOA_Attribute Attribute, float OldValue, float NewValue);
 
 protected:
 	
+	/// Adds the component’s entry to the attribute store, starting from the configured values.
 	virtual void BeginPlay() override;
 
+	/// Removes the component’s entry from the attribute store.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:	
 	
-	/// Current health of the actor.
+	/// Starting health of the actor.
 	UPROPERTY(EditAnywhere, Category = "Actor Attributes",
-		meta = (ToolTip = "Current health of the actor, editable in Blueprints or instances."))
+		meta = (ToolTip = "Starting health of the actor, editable in Blueprints or instances. The live value is kept by the attribute store once play begins."))
 	float Health = 100.f;
 
 	/// Maximum health of the actor.
@@ -40,13 +60,69 @@ private:
 		meta = (ToolTip = "Maximum health of the actor, editable in Blueprints or instances."))
 	float MaxHealth = 100.f;
 
+	/// Health regenerated per second.
+	UPROPERTY(EditAnywhere, Category = "Actor Attributes",
+		meta = (ClampMin = "0.0", ToolTip = "Health regenerated per second while the actor is alive, applied by the attribute store’s batched pass."))
+	float HealthRegenRate = 0.f;
+
+	/// Starting stamina of the actor.
+	UPROPERTY(EditAnywhere, Category = "Actor Attributes",
+		meta = (ToolTip = "Starting stamina of the actor, editable in Blueprints or instances."))
+	float Stamina = 100.f;
+
+	/// Maximum stamina of the actor.
+	UPROPERTY(EditAnywhere, Category = "Actor Attributes",
+		meta = (ToolTip = "Maximum stamina of the actor, editable in Blueprints or instances."))
+	float MaxStamina = 100.f;
+
+	/// Stamina regenerated per second.
+	UPROPERTY(EditAnywhere, Category = "Actor Attributes",
+		meta = (ClampMin = "0.0", ToolTip = "Stamina regenerated per second, applied by the attribute store’s batched pass."))
+	float StaminaRegenRate = 0.f;
+
+	/// Store holding the live values, set while the component is registered.
+	UPROPERTY(Transient)
+	UAEOA_AttributeStoreSubsystem* Store;
+
+	/// Handle of the component’s entry in Store.
+	int32 StoreHandle = INDEX_NONE;
+
+	/// Gets the live value of an attribute, or its configured starting value before play begins.
+	float GetAttributeValue(EAEOA_Attribute Attribute) const;
+
+	/// Gets the maximum of an attribute.
+	float GetAttributeMaxValue(EAEOA_Attribute Attribute) const;
+
 public:
 
 	/// Reduces the actor’s health by the specified damage amount, clamping between 0 and MaxHealth.
 	/// @param Damage The amount of damage to apply to the actor’s health.
 	void ReceiveDamage(float Damage);
 
+	/// Restores the actor’s health to MaxHealth, e.g., when a pooled enemy is reused.
+	void ResetHealth();
+
+	/// Sets the actor’s health, clamped between 0 and MaxHealth, e.g., when an enemy is promoted from the crowd.
+	/// @param NewHealth The health to set.
+	void SetHealth(float NewHealth);
+
+	/// Gets the current health of the actor.
+	/// @return float The current health.
+	float GetHealth() const { return GetAttributeValue(EAEOA_Attribute::EA_Health); }
+
+	/// Gets the maximum health of the actor.
+	/// @return float The maximum health.
+	float GetMaxHealth() const { return GetAttributeMaxValue(EAEOA_Attribute::EA_Health); }
+
+	/// Gets the current stamina of the actor.
+	/// @return float The current stamina.
+	float GetStamina() const { return GetAttributeValue(EAEOA_Attribute::EA_Stamina); }
+
 	/// Calculates the current health percentage as a fraction of MaxHealth.
 	/// @return The health percentage (0.0 to 1.0).
-	float GetHealthPercent();
+	float GetHealthPercent() const;
+
+	/// Gets the handle of the component’s entry in the attribute store, e.g., for UAEOA_AttributeStoreSubsystem::ApplyBulkDamage.
+	/// @return int32 The handle, or INDEX_NONE before play begins.
+	FORCEINLINE int32 GetStoreHandle() const { return StoreHandle; }
 };
@@ -0,0 +1,129 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_AttributeStoreSubsystem class, a world subsystem that
+// stores the attributes of every attribute component in flat arrays and
+// runs regeneration and bulk damage as one parallel pass.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_AttributeStoreSubsystem.generated.h"
+
+class UAEOA_AttributeComponent;
+
+/// Attributes held by the store, each with a value, a maximum and a regeneration rate.
+UENUM(BlueprintType)
+enum class EAEOA_Attribute : uint8
+{
+	EA_Health UMETA(DisplayName = "Health"),
+	EA_Stamina UMETA(DisplayName = "Stamina"),
+
+	EA_MAX UMETA(Hidden)
+};
+
+/// Damage to apply to one entry of the store in a bulk pass.
+struct FAEOA_AttributeDamage
+{
+	int32 Handle = INDEX_NONE;
+	float Amount = 0.f;
+};
+
+/**
+ * World subsystem owning the live attribute values of every UAEOA_AttributeComponent.
+ * Each attribute is three parallel arrays (value, maximum, regeneration per second) indexed by the
+ * handle of its component. At AEOA.Attributes.UpdateInterval, regeneration and queued bulk damage run
+ * in one ParallelFor over the entries; afterwards only the entries whose values actually changed
+ * notify their component, which broadcasts its change events to the UI and AI.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_AttributeStoreSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Drops every entry when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Runs the regeneration pass at the configured interval.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Adds an entry for a component, with every attribute at zero until initialized.
+	/// @param Component The component notified when the entry’s values change.
+	/// @return int32 The handle of the entry, stable until RemoveEntry.
+	int32 AddEntry(UAEOA_AttributeComponent* Component);
+
+	/// Frees an entry for reuse.
+	/// @param Handle The handle returned by AddEntry.
+	void RemoveEntry(int32 Handle);
+
+	/// Sets the value, maximum and regeneration rate of an attribute without notifying the component.
+	/// @param Handle The handle returned by AddEntry.
+	/// @param Attribute The attribute to initialize.
+	/// @param Value The starting value, clamped between 0 and MaxValue.
+	/// @param MaxValue The maximum value.
+	/// @param RegenRate Regeneration per second, applied by the regeneration pass.
+	void InitializeAttribute(int32 Handle, EAEOA_Attribute Attribute, float Value, float MaxValue, float RegenRate);
+
+	/// Sets the value of an attribute immediately, notifying the component if it changed.
+	/// @param Handle The handle returned by AddEntry.
+	/// @param Attribute The attribute to set.
+	/// @param NewValue The new value, clamped between 0 and the maximum.
+	void SetValue(int32 Handle, EAEOA_Attribute Attribute, float NewValue);
+
+	/// Gets the value of an attribute.
+	/// @return float The value, or 0 for an invalid handle.
+	float GetValue(int32 Handle, EAEOA_Attribute Attribute) const;
+
+	/// Gets the maximum of an attribute.
+	/// @return float The maximum, or 0 for an invalid handle.
+	float GetMaxValue(int32 Handle, EAEOA_Attribute Attribute) const;
+
+	/// Applies damage to the health of many entries in one parallel pass, then notifies the changed components.
+	/// Several damages to the same entry add up.
+	/// @param Damages The entries and amounts to apply.
+	void ApplyBulkDamage(TConstArrayView<FAEOA_AttributeDamage> Damages);
+
+private:
+
+	/// Values, maximums and regeneration rates of one attribute, indexed by handle.
+	struct FAttributeColumn
+	{
+		TArray<float> Values;
+		TArray<float> MaxValues;
+		TArray<float> RegenRates;
+		TArray<float> PreviousValues;
+	};
+
+	/// Applies pending damage and DeltaTime seconds of regeneration to every entry in parallel, flagging the changes.
+	void RunPass(float DeltaTime);
+
+	/// Notifies the components of every flagged entry, then clears the flags.
+	void DispatchChanges();
+
+	/// Component of each entry, nullptr for free entries.
+	UPROPERTY()
+	TArray<UAEOA_AttributeComponent*> Components;
+
+	/// One column per attribute.
+	FAttributeColumn Columns[static_cast<int32>(EAEOA_Attribute::EA_MAX)];
+
+	/// Health damage queued for the next pass, per entry.
+	TArray<float> PendingDamage;
+
+	/// Bit N set when attribute N of the entry changed during the last pass.
+	TArray<uint8> ChangedMasks;
+
+	/// Handles of the free entries.
+	TArray<int32> FreeHandles;
+
+	/// Time accumulated since the last regeneration pass.
+	float TimeSinceUpdate = 0.f;
+};
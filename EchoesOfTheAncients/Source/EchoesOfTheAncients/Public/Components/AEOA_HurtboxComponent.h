@@ -0,0 +1,108 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_HurtboxComponent class, a component giving a hittable
+// actor a few simple query-only shapes (head, torso, limbs) that weapons
+// trace against, each with its own damage multiplier.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "AEOA_HurtboxComponent.generated.h"
+
+class UShapeComponent;
+
+/// Primitive used by a hurtbox shape.
+UENUM(BlueprintType)
+enum class EAEOA_HurtboxShapeType : uint8
+{
+	EHST_Sphere UMETA(DisplayName = "Sphere"),
+	EHST_Capsule UMETA(DisplayName = "Capsule"),
+	EHST_Box UMETA(DisplayName = "Box")
+};
+
+/// One hurtbox shape, attached to a bone of the owner’s skeletal mesh or to the hurtbox component.
+USTRUCT(BlueprintType)
+struct FAEOA_HurtboxShape
+{
+	GENERATED_BODY()
+
+	/// Name of the shape, e.g., Head or Torso.
+	UPROPERTY(EditAnywhere, Category = "Hurtbox",
+		meta = (ToolTip = "Name of the shape (e.g., Head, Torso, LeftArm)."))
+	FName ShapeName;
+
+	/// Bone the shape follows.
+	UPROPERTY(EditAnywhere, Category = "Hurtbox",
+		meta = (ToolTip = "Bone of the owner's skeletal mesh the shape follows (e.g., head). Leave empty to attach the shape to the hurtbox component."))
+	FName BoneName;
+
+	/// Primitive of the shape.
+	UPROPERTY(EditAnywhere, Category = "Hurtbox",
+		meta = (ToolTip = "Primitive of the shape."))
+	EAEOA_HurtboxShapeType ShapeType = EAEOA_HurtboxShapeType::EHST_Capsule;
+
+	/// Size of the shape.
+	UPROPERTY(EditAnywhere, Category = "Hurtbox",
+		meta = (ToolTip = "Sphere: X is the radius. Capsule: X is the radius, Z the half height. Box: the half extents."))
+	FVector Extent = FVector(20.f, 20.f, 40.f);
+
+	/// Transform of the shape relative to its bone.
+	UPROPERTY(EditAnywhere, Category = "Hurtbox",
+		meta = (ToolTip = "Transform of the shape relative to its bone, or to the hurtbox component."))
+	FTransform RelativeTransform;
+
+	/// Multiplier applied to the damage of hits landing on this shape.
+	UPROPERTY(EditAnywhere, Category = "Hurtbox",
+		meta = (ClampMin = "0.0", ToolTip = "Multiplier applied to the damage of weapon hits landing on this shape (e.g., 1.5 for the head)."))
+	float DamageMultiplier = 1.f;
+};
+
+/**
+ * Hurtbox of a hittable actor (enemies, breakables).
+ * Creates one query-only shape per entry of Shapes on the Hurtbox object channel when play begins.
+ * Weapon queries only look for that channel, so they no longer touch scenery or every body of a physics asset,
+ * and skeletal meshes do not need to generate overlaps. Without entries, one capsule matching the owner’s capsule is used.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class ECHOESOFTHEANCIENTS_API UAEOA_HurtboxComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UAEOA_HurtboxComponent();
+
+	/// Enables or disables every shape, e.g., when the owner dies.
+	/// @param bEnabled Whether weapons can hit the shapes.
+	void SetHurtboxEnabled(bool bEnabled);
+
+	/// Returns the damage multiplier of a hurtbox shape.
+	/// @param HitComponent The component reported by a weapon query.
+	/// @return float The multiplier of the shape, or 1 if the component is not a hurtbox shape.
+	static float GetDamageMultiplier(const UPrimitiveComponent* HitComponent);
+
+protected:
+
+	/// Creates the shapes.
+	virtual void BeginPlay() override;
+
+	/// Destroys the shapes.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+
+	/// Creates and registers the shape component of an entry.
+	UShapeComponent* CreateShape(const FAEOA_HurtboxShape& Shape);
+
+	/// Shapes of the hurtbox, editable in Blueprints.
+	UPROPERTY(EditAnywhere, Category = "Hurtbox",
+		meta = (ToolTip = "Simple shapes weapons can hit (e.g., head, torso, limbs), each with a damage multiplier. Leave empty for one capsule matching the owner's capsule."))
+	TArray<FAEOA_HurtboxShape> Shapes;
+
+	/// Shape components created at BeginPlay, in the order of Shapes.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UShapeComponent>> ShapeComponents;
+
+	/// Damage multiplier of each shape component.
+	TArray<float> DamageMultipliers;
+};
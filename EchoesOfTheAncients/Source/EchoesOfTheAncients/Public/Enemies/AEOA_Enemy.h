@@ -1,21 +1,24 @@
 // Copyright © 2025 Kdean Games. All Rights Reserved
 // Defines the AEnemy class, a base class for enemies in Echoes of the Ancients.
 // Enemies are hittable targets for Aria’s attacks, configured to interact with 
-// weapon box traces.
+// weapon box traces. Dead enemies are recycled through UAEOA_EnemyPoolSubsystem.
 
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Characters/AEOA_MontageSectionTable.h"
 #include "Characters/CharacterTypes.h"
+#include "Enemies/AEOA_EnemySignificanceSubsystem.h"
 #include "GameFramework/Character.h"
 #include "Interfaces/HitInterface.h"
 #include "AEOA_Enemy.generated.h"
 
 // Forward declarations to minimize header dependencie
 class UAEOA_AttributeComponent;
-class UAEOA_HealthBarComponent;
+class UAEOA_HurtboxComponent;
 class UAnimMontage;
 class UParticleSystem;
+class UStaticMesh;
 class USoundBase;
 
 UCLASS()
@@ -27,9 +30,6 @@ public:
 	/// Constructor for AEnemy, initializes enemy properties and components.
 	AAEOA_Enemy();
 
-	/// Called every frame, updates enemy state.
-	virtual void Tick(float DeltaTime) override;
-
 	/// Called to bind functionality to input (not used for AI-controlled enemies, but required override).
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
@@ -39,7 +39,7 @@ public:
 
 	void DirectionalHitReact(const FVector& ImpactPoint);
 
-	/// Handles damage application, reducing health and updating the health bar.
+	/// Handles damage application, reducing health (the health bar follows through OnHealthChanged).
 	/// @param DamageAmount The amount of damage to apply.
 	/// @param DamageEvent The damage event data.
 	/// @param EventInstigator The controller responsible for the damage.
@@ -47,15 +47,65 @@ public:
 	/// @return The amount of damage actually applied.
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
 
+	/// Called by UAEOA_EnemyPoolSubsystem when the enemy is handed out, resets its health, death pose, collision and health bar.
+	virtual void OnAcquiredFromPool();
+
+	/// Called by UAEOA_EnemyPoolSubsystem when the enemy is parked, hides it and disables its collision and ticks.
+	virtual void OnReleasedToPool();
+
+	/// Called by UAEOA_CombatAwarenessSubsystem when the combat target enters or leaves CombatRadius.
+	/// Leaving clears the target and hides the health bar.
+	/// @param bInRange Whether the target is now within CombatRadius.
+	void OnCombatRangeChanged(bool bInRange);
+
+	/// Called by UAEOA_EnemyCrowdSubsystem when the enemy replaces a crowd entity, carrying over its health.
+	/// @param Health The health of the crowd entity.
+	void ApplyCrowdState(float Health);
+
+	/// Checks if the enemy is alive.
+	/// @return bool True if its health is above zero.
+	bool IsAlive() const;
+
+	/// Runs the enemy’s decision logic (target selection, movement goals), scheduled by UAEOA_EnemyThinkSubsystem
+	/// instead of the actor tick, more often for significant enemies. Override in Blueprints to add behavior.
+	/// @param DeltaSinceLastThink Seconds since the enemy last thought, 0 on its first think.
+	UFUNCTION(BlueprintNativeEvent, Category = "AI")
+	void Think(float DeltaSinceLastThink);
+
+	/// Called by UAEOA_EnemySignificanceSubsystem when the enemy changes significance tier.
+	/// @param NewSignificance The new tier.
+	void SetSignificance(EAEOA_EnemySignificance NewSignificance) { Significance = NewSignificance; }
+
 private:
 
 	/// Component for managing the enemy’s attributes, such as health.
 	UPROPERTY(VisibleAnywhere)
 	UAEOA_AttributeComponent* Attributes;
 
-	/// Custom widget component to display the health bar above the enemy’s head in screen space.
+	/// Shapes weapons can hit, each with a damage multiplier.
 	UPROPERTY(VisibleAnywhere)
-	UAEOA_HealthBarComponent* HealthBarWidget;
+	UAEOA_HurtboxComponent* Hurtbox;
+
+	/// Offset of the health bar from the enemy’s location, drawn by UAEOA_HealthBarSubsystem.
+	UPROPERTY(EditAnywhere, Category = "UI",
+		meta = (ToolTip = "Offset of the health bar from the enemy’s location (capsule center), in world space. The bar is drawn by the batched health bar layer once the enemy is first hit."))
+	FVector HealthBarOffset = FVector(0.f, 0.f, 110.f);
+
+	/// Slot of the enemy’s health bar in UAEOA_HealthBarSubsystem, allocated the first time the bar is shown.
+	int32 HealthBarSlot = INDEX_NONE;
+
+	/// Shows or hides the health bar, allocating its slot the first time it is shown.
+	/// @param bVisible Whether the bar is drawn.
+	void SetHealthBarVisible(bool bVisible);
+
+	/// Pushes the current health percentage to the health bar, if the enemy has one.
+	void UpdateHealthBarPercent();
+
+	/// Returns the health bar slot to UAEOA_HealthBarSubsystem.
+	void ReleaseHealthBar();
+
+	/// Bound to the attribute component’s OnHealthChanged, refreshes the health bar.
+	void HandleHealthChanged(UAEOA_AttributeComponent* Component, float OldHealth, float NewHealth);
 
 	/**
 	 * Animation montages
@@ -80,19 +130,69 @@ private:
 		meta = (ToolTip = "Particle system to spawn when the enemy is hit, set in the default Blueprint or on individual instances."))
 	UParticleSystem* HitParticles;
 
-	/// The current combat target (e.g., Aria), set when the enemy takes damage, used to manage health bar visibility.
+	/// The current combat target (e.g., Aria), set when the enemy takes damage, tracked by UAEOA_CombatAwarenessSubsystem to manage health bar visibility.
 	UPROPERTY()
 	AActor* CombatTarget;
 
+	/// Current significance tier, Engaged while the enemy is not managed by the significance subsystem.
+	UPROPERTY(VisibleInstanceOnly, Category = "AI")
+	EAEOA_EnemySignificance Significance = EAEOA_EnemySignificance::EES_Engaged;
+
+	/// Time the corpse stays in the level before the enemy is recycled.
+	UPROPERTY(EditAnywhere, Category = "Pooling",
+		meta = (ClampMin = "0.0", ToolTip = "Seconds the corpse stays in the level after the death animation starts, before the enemy returns to the enemy pool (or is destroyed without one)."))
+	float CorpseLifeSpan = 6.f;
+
+	/// Timer returning the corpse to the pool.
+	FTimerHandle CorpseTimerHandle;
+
+	/// Returns the corpse to the enemy pool, or destroys it if there is no pool.
+	void OnCorpseExpired();
+
+	/// Time the corpse keeps animating after the death montage ends, letting the death pose blend in before it is frozen.
+	UPROPERTY(EditAnywhere, Category = "Pooling",
+		meta = (ClampMin = "0.0", ToolTip = "Seconds the corpse keeps animating after the death montage ends (so the death pose finishes blending in) before its pose is frozen and its animation, movement and ticks are turned off."))
+	float CorpseFreezeDelay = 0.2f;
+
+	/// Whether the corpse is frozen, so a recycled enemy knows to resume animating.
+	bool bCorpseFrozen = false;
+
+	/// Timer freezing the corpse once the death pose has settled.
+	FTimerHandle CorpseFreezeTimerHandle;
+
+	/// Bound to the end of the death montage, schedules the corpse freeze.
+	void OnDeathMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+
+	/// Turns off the animation, movement and ticks of the corpse; does nothing once the enemy is alive again.
+	/// The skeletal mesh keeps rendering the last evaluated pose at no CPU cost.
+	void FreezeCorpse();
+
+	/// Resumes animation, movement and ticks of a frozen corpse.
+	void UnfreezeCorpse();
+
+	/// Registers the enemy with the hittable grid, the significance subsystem and the think scheduler.
+	void RegisterWithWorldSubsystems();
+
+	/// Unregisters the enemy from the think, significance, hittable grid and combat awareness subsystems.
+	void UnregisterFromWorldSubsystems();
+
 	/// The radius within which the enemy considers itself in combat, controlling health bar visibility.
 	UPROPERTY(EditAnywhere, meta = (ToolTip = "The radius (in units) within which the enemy considers itself in combat, showing the health bar if the target is within this range."))
 	double CombatRadius = 500.f;
 
+	/// Static mesh drawing the enemy while it is a distant crowd entity.
+	UPROPERTY(EditDefaultsOnly, Category = "Crowd",
+		meta = (ToolTip = "Static mesh (e.g., a baked idle pose) drawing the enemy while it is simulated by the crowd subsystem far from Aria. Leave empty to keep the class out of the crowd."))
+	UStaticMesh* CrowdMesh;
+
 protected:
 
 	/// Called when the game starts or when spawned, initializes enemy behavior.
 	virtual void BeginPlay() override;
 
+	/// Called when the enemy is removed from the world, unregisters it from the world subsystems tracking it.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/// Plays a random death animation when the enemy’s health reaches zero.
 	void Die();
 
@@ -100,8 +200,14 @@ protected:
 	 * Play montage functions
 	 */
 	 /// Plays the hit react montage with the specified section.
-	 /// @param SectionName The name of the section to play (e.g., "FromLeft", "FromRight").
-	void PlayHitReactMontage(const FName& SectionName);
+	 /// @param SectionEntry Entry of the section in the hit react section table (front, left, right or back).
+	void PlayHitReactMontage(int32 SectionEntry);
+
+	/// Death sections (Death1 to Death4), entry N leaving the enemy in death pose N + 1.
+	FAEOA_MontageSectionTable DeathSections;
+
+	/// Hit react sections (FromFront, FromLeft, FromRight, FromBack), selected by hit direction.
+	FAEOA_MontageSectionTable HitReactSections;
 
 	/// The current death pose of the enemy, used to determine the final pose after death animation.
 	UPROPERTY(BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
@@ -110,4 +216,20 @@ protected:
 public:
 	// Getters and setters
 
+	/// Gets the current combat target.
+	/// @return AActor* The actor that last damaged the enemy while in range, or nullptr.
+	FORCEINLINE AActor* GetCombatTarget() const { return CombatTarget; }
+
+	/// Gets the current significance tier.
+	/// @return EAEOA_EnemySignificance The tier assigned by UAEOA_EnemySignificanceSubsystem.
+	FORCEINLINE EAEOA_EnemySignificance GetSignificance() const { return Significance; }
+
+	/// Gets the attribute component.
+	/// @return UAEOA_AttributeComponent* The component holding the enemy’s health.
+	FORCEINLINE UAEOA_AttributeComponent* GetAttributes() const { return Attributes; }
+
+	/// Gets the crowd mesh.
+	/// @return UStaticMesh* The mesh drawing the enemy as a crowd entity, or nullptr if the class is not simulated by the crowd.
+	FORCEINLINE UStaticMesh* GetCrowdMesh() const { return CrowdMesh; }
+
 };
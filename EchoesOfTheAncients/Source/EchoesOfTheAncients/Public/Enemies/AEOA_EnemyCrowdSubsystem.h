@@ -0,0 +1,144 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_EnemyCrowdSubsystem class, a world subsystem simulating
+// distant enemies as lightweight crowd entities rendered with instanced
+// meshes, promoting them to AAEOA_Enemy actors near Aria and back.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_EnemyCrowdSubsystem.generated.h"
+
+class AAEOA_Enemy;
+class UInstancedStaticMeshComponent;
+
+/// Crowd entities of one enemy class, stored as parallel arrays (position, velocity, health, target) with one mesh instance each.
+USTRUCT()
+struct FAEOA_CrowdArchetype
+{
+	GENERATED_BODY()
+
+	/// Enemy class the entities are promoted to.
+	UPROPERTY()
+	TSubclassOf<AAEOA_Enemy> EnemyClass;
+
+	/// Instanced mesh rendering the entities, instance N is entity N.
+	UPROPERTY()
+	UInstancedStaticMeshComponent* Instances = nullptr;
+
+	/// Transform of the enemy’s skeletal mesh relative to its capsule, applied to every instance.
+	FTransform MeshOffset;
+
+	/// Walk speed of the enemy class.
+	float Speed = 0.f;
+
+	/// Capsule center of each entity.
+	TArray<FVector> Positions;
+
+	/// Velocity of each entity.
+	TArray<FVector> Velocities;
+
+	/// Facing of each entity, in degrees.
+	TArray<float> Yaws;
+
+	/// Health of each entity, carried over exactly on promotion and demotion.
+	TArray<float> Healths;
+
+	/// Actor each entity walks toward (e.g., Aria), kept by the subsystem while the entity is promoted.
+	TArray<TWeakObjectPtr<AActor>> Targets;
+
+	/// Scratch buffer of instance transforms.
+	TArray<FTransform> InstanceTransforms;
+};
+
+/**
+ * World subsystem running hundreds of distant barbarians without characters.
+ * Entities walk toward their target in one batched pass and are drawn by one instanced mesh per enemy class.
+ * Entities closer to Aria than AEOA.Crowd.PromoteRadius become real enemies (from the enemy pool).
+ * Every enemy of a crowd class registers itself, whether promoted, level-placed or activated by a spawn point,
+ * and goes back to the crowd once alive, unengaged and farther than AEOA.Crowd.DemoteRadius.
+ * Enemy classes opt in by setting their CrowdMesh.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_EnemyCrowdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Drops every entity and instanced mesh when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Moves the entities and re-evaluates promotions and demotions at the configured interval.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Adds a full-health crowd entity of the given class.
+	/// @param EnemyClass The enemy class, which must have a CrowdMesh.
+	/// @param Location World location of the entity’s capsule center.
+	/// @param Rotation World rotation of the entity, only its yaw is kept.
+	/// @param Target Actor the entity walks toward, or nullptr to stand still.
+	/// @return bool False if the class has no CrowdMesh.
+	UFUNCTION(BlueprintCallable, Category = "Crowd")
+	bool SpawnCrowdEnemy(TSubclassOf<AAEOA_Enemy> EnemyClass, const FVector& Location, const FRotator& Rotation, AActor* Target);
+
+	/// Makes an enemy actor a candidate for demotion, if its class has a CrowdMesh. Called by the enemy when it becomes active.
+	/// @param Enemy The enemy to track.
+	void RegisterEnemy(AAEOA_Enemy* Enemy);
+
+	/// Stops tracking an enemy, e.g., when it returns to the pool or is destroyed.
+	/// @param Enemy The enemy to forget.
+	void UnregisterEnemy(AAEOA_Enemy* Enemy);
+
+	/// Gets the number of crowd entities across every class.
+	/// @return int32 The number of entities.
+	int32 GetNumEntities() const;
+
+private:
+
+	/// Finds or creates the archetype of an enemy class.
+	/// @return int32 The archetype index, or INDEX_NONE if the class has no CrowdMesh.
+	int32 FindOrAddArchetype(TSubclassOf<AAEOA_Enemy> EnemyClass);
+
+	/// Appends an entity and its mesh instance.
+	void AddEntity(int32 ArchetypeIndex, const FVector& Location, float Yaw, float Health, AActor* Target);
+
+	/// Removes an entity and its mesh instance with a swap.
+	void RemoveEntity(int32 ArchetypeIndex, int32 EntityIndex);
+
+	/// Walks every entity toward its target and updates the instances of the archetypes that moved.
+	void SimulateEntities(float DeltaTime);
+
+	/// Promotes entities near Aria and demotes promoted enemies far from her, within the per-update budget.
+	void UpdatePromotions();
+
+	/// Replaces an entity with an enemy actor carrying its health; the subsystem keeps the entity’s target.
+	void PromoteEntity(int32 ArchetypeIndex, int32 EntityIndex);
+
+	/// Replaces an enemy actor with an entity carrying its health and the given target.
+	void DemoteEnemy(AAEOA_Enemy* Enemy, AActor* Target);
+
+	/// Crowd entities, one archetype per enemy class.
+	UPROPERTY()
+	TArray<FAEOA_CrowdArchetype> Archetypes;
+
+	/// Active enemies of crowd classes, candidates for demotion.
+	UPROPERTY()
+	TArray<AAEOA_Enemy*> TrackedEnemies;
+
+	/// Target each tracked enemy walks toward once demoted, set for enemies promoted from a walking entity.
+	TArray<TWeakObjectPtr<AActor>> TrackedTargets;
+
+	/// Owner of the instanced meshes.
+	UPROPERTY()
+	AActor* InstanceOwner = nullptr;
+
+	/// Time accumulated since the last promotion pass.
+	float TimeSinceUpdate = 0.f;
+};
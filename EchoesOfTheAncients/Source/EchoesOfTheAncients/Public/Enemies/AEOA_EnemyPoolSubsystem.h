@@ -0,0 +1,84 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_EnemyPoolSubsystem class, a world subsystem that recycles
+// enemies after their corpse period instead of destroying them, and hands them
+// back out at spawn points for the next wave.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_EnemyPoolSubsystem.generated.h"
+
+class AAEOA_Enemy;
+
+/// Pooled instances and usage counters for a single enemy class.
+USTRUCT()
+struct FAEOA_EnemyPool
+{
+	GENERATED_BODY()
+
+	/// Dormant instances ready to be handed out.
+	UPROPERTY()
+	TArray<AAEOA_Enemy*> Available;
+
+	/// Number of instances requested through ReserveEnemies, the target size of the pool.
+	int32 Reserved = 0;
+
+	/// Number of instances of this class spawned by the pool, pre-warmed or on a miss.
+	int32 Spawned = 0;
+
+	/// Number of acquisitions served from Available.
+	int32 Hits = 0;
+
+	/// Number of acquisitions that had to spawn a new instance.
+	int32 Misses = 0;
+};
+
+/**
+ * World subsystem pooling enemies per class.
+ * Spawn points reserve instances when they begin play and acquire them for each wave;
+ * dead enemies release themselves back to the pool once their corpse period is over,
+ * keeping their mesh, anim instance and components alive for the next wave.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_EnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Clears the pools when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Grows the pool of the given class by Count dormant instances, spawning them immediately.
+	/// @param EnemyClass The enemy class to pre-warm (e.g., BP_Barbarian).
+	/// @param Count The number of additional instances to keep ready.
+	void ReserveEnemies(TSubclassOf<AAEOA_Enemy> EnemyClass, int32 Count = 1);
+
+	/// Hands out an enemy of the given class at the given transform, spawning one if the pool is empty.
+	/// @param EnemyClass The enemy class to acquire.
+	/// @param Location World location of the enemy’s capsule center.
+	/// @param Rotation World rotation of the enemy.
+	/// @return AAEOA_Enemy* The active enemy, or nullptr if it could not be spawned.
+	AAEOA_Enemy* AcquireEnemy(TSubclassOf<AAEOA_Enemy> EnemyClass, const FVector& Location, const FRotator& Rotation);
+
+	/// Returns an enemy to the pool of its class, hiding it and disabling its collision and ticks.
+	/// Level-placed enemies are accepted too and become available to later acquisitions.
+	/// @param Enemy The enemy to release.
+	void ReleaseEnemy(AAEOA_Enemy* Enemy);
+
+	/// Writes the per-class pool sizes and hit rates to the log.
+	void DumpStats() const;
+
+private:
+
+	/// Spawns a dormant instance of the given class for the pool.
+	AAEOA_Enemy* SpawnPooledEnemy(UClass* EnemyClass);
+
+	/// Pools keyed by enemy class.
+	UPROPERTY()
+	TMap<UClass*, FAEOA_EnemyPool> Pools;
+};
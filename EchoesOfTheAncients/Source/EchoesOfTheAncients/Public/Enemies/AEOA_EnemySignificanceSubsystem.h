@@ -0,0 +1,85 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_EnemySignificanceSubsystem class, a world subsystem that
+// sorts enemies into significance tiers from their distance to Aria and
+// their visibility, and throttles their ticks per tier.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_EnemySignificanceSubsystem.generated.h"
+
+class AAEOA_Enemy;
+
+/// Significance tier of an enemy, from most to least significant.
+UENUM(BlueprintType)
+enum class EAEOA_EnemySignificance : uint8
+{
+	EES_Engaged UMETA(DisplayName = "Engaged"),
+	EES_Nearby UMETA(DisplayName = "Nearby"),
+	EES_Distant UMETA(DisplayName = "Distant"),
+	EES_Culled UMETA(DisplayName = "Culled"),
+
+	EES_MAX UMETA(Hidden)
+};
+
+/**
+ * World subsystem re-evaluating the significance of every enemy in one batched pass.
+ * Engaged enemies (with a combat target) and nearby ones tick at full rate; distant visible enemies
+ * and culled ones (far or unseen) get longer tick intervals for their actor, movement and components.
+ * Thresholds and intervals are console variables under AEOA.Significance.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_EnemySignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Releases every registered enemy when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Re-evaluates the tiers at the configured interval and publishes the tier stats.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Starts managing the ticks of the enemy, at full rate until the next evaluation.
+	/// @param Enemy The enemy to register, ignored if it is already registered.
+	void RegisterEnemy(AAEOA_Enemy* Enemy);
+
+	/// Stops managing the enemy and restores its full tick rate.
+	/// @param Enemy The enemy to unregister, ignored if it is not registered.
+	void UnregisterEnemy(AAEOA_Enemy* Enemy);
+
+	/// Gets the current tier of an enemy.
+	/// @param Enemy The enemy to look up.
+	/// @return EAEOA_EnemySignificance The tier, or Engaged if the enemy is not registered.
+	EAEOA_EnemySignificance GetSignificance(const AAEOA_Enemy* Enemy) const;
+
+private:
+
+	/// Computes the tier of every enemy and applies the tick intervals of those that changed tier.
+	void EvaluateTiers();
+
+	/// Applies the tick intervals of a tier to the actor, its movement and its ticking components.
+	static void ApplyTier(AAEOA_Enemy* Enemy, EAEOA_EnemySignificance Tier);
+
+	/// Returns the tick interval of a tier, in seconds.
+	static float GetTierTickInterval(EAEOA_EnemySignificance Tier);
+
+	/// Registered enemies, indexed in parallel with Tiers.
+	UPROPERTY()
+	TArray<AAEOA_Enemy*> Enemies;
+
+	/// Current tier of each enemy.
+	TArray<EAEOA_EnemySignificance> Tiers;
+
+	/// Time accumulated since the last evaluation.
+	float TimeSinceUpdate = 0.f;
+};
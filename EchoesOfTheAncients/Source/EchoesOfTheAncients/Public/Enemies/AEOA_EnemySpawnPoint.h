@@ -0,0 +1,61 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the AAEOA_EnemySpawnPoint class, a level-placed marker that
+// pre-warms the enemy pool and activates pooled enemies on demand.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AEOA_EnemySpawnPoint.generated.h"
+
+class AAEOA_Enemy;
+class UArrowComponent;
+
+/**
+ * Spawn point for enemy waves.
+ * Reserves pooled instances of its enemy class when play begins, so waves reuse
+ * enemies recycled by UAEOA_EnemyPoolSubsystem instead of constructing new characters.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API AAEOA_EnemySpawnPoint : public AActor
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Constructor for AAEOA_EnemySpawnPoint, creates the root and the editor arrow.
+	AAEOA_EnemySpawnPoint();
+
+	/// Activates a pooled enemy standing on the spawn point, facing its forward direction.
+	/// @return AAEOA_Enemy* The enemy, or nullptr if no class is set or it could not be spawned.
+	UFUNCTION(BlueprintCallable, Category = "Spawning")
+	AAEOA_Enemy* SpawnEnemy();
+
+protected:
+
+	/// Called when the game starts, reserves the pooled enemies and spawns the first one if requested.
+	virtual void BeginPlay() override;
+
+private:
+
+	/// Class of the enemies spawned here.
+	UPROPERTY(EditAnywhere, Category = "Spawning",
+		meta = (ToolTip = "Enemy class spawned by this point (e.g., BP_Barbarian)."))
+	TSubclassOf<AAEOA_Enemy> EnemyClass;
+
+	/// Number of pooled enemies reserved when play begins.
+	UPROPERTY(EditAnywhere, Category = "Spawning",
+		meta = (ClampMin = "0", ToolTip = "Number of dormant enemies this point adds to the enemy pool when play begins, so waves do not construct characters mid-fight."))
+	int32 PoolReserve = 2;
+
+	/// Whether an enemy is spawned when play begins.
+	UPROPERTY(EditAnywhere, Category = "Spawning",
+		meta = (ToolTip = "Spawn one enemy when play begins. Disable for points driven by a wave Blueprint."))
+	bool bSpawnOnBeginPlay = false;
+
+#if WITH_EDITORONLY_DATA
+	/// Arrow showing the facing of spawned enemies in the editor.
+	UPROPERTY()
+	UArrowComponent* Arrow;
+#endif
+};
@@ -0,0 +1,75 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_EnemyThinkSubsystem class, a world subsystem that owns
+// the think step of every enemy and runs it round-robin under a fixed
+// per-frame time budget, most significant enemies first.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enemies/AEOA_EnemySignificanceSubsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_EnemyThinkSubsystem.generated.h"
+
+class AAEOA_Enemy;
+
+/**
+ * World subsystem scheduling the decision logic of enemies instead of their own ticks.
+ * Each frame the tiers are served in significance order (engaged, nearby, distant, culled);
+ * within a tier, enemies whose think interval has elapsed are updated round-robin from where the
+ * previous frame stopped, until AEOA.Think.BudgetMs is spent. Enemies left over wait for the next frame,
+ * so the cost stays flat as the enemy count grows and only the think delays lengthen.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_EnemyThinkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Releases every registered enemy when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Runs the think steps that fit in the frame budget and publishes the scheduler stats.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Starts scheduling the think step of the enemy; its first think runs as soon as the budget allows.
+	/// @param Enemy The enemy to register, ignored if it is already registered.
+	void RegisterEnemy(AAEOA_Enemy* Enemy);
+
+	/// Stops scheduling the enemy, e.g., when it dies or returns to the pool.
+	/// @param Enemy The enemy to unregister, ignored if it is not registered.
+	void UnregisterEnemy(AAEOA_Enemy* Enemy);
+
+private:
+
+	/// Runs the due think steps of one tier, starting at the tier's cursor.
+	/// @return bool False if the frame budget ran out before the tier was done.
+	bool ThinkTier(EAEOA_EnemySignificance Tier, double Now, double BudgetEndTime);
+
+	/// Returns the think interval of a tier, in seconds.
+	static float GetTierThinkInterval(EAEOA_EnemySignificance Tier);
+
+	/// Registered enemies, indexed in parallel with LastThinkTimes.
+	UPROPERTY()
+	TArray<AAEOA_Enemy*> Enemies;
+
+	/// World time of each enemy's last think step.
+	TArray<double> LastThinkTimes;
+
+	/// Round-robin position of each tier in Enemies.
+	int32 TierCursors[static_cast<int32>(EAEOA_EnemySignificance::EES_MAX)] = {};
+
+	/// Number of think steps run this frame.
+	int32 NumThinks = 0;
+
+	/// Sum and maximum of the think delays of this frame (time past each enemy's interval), in seconds.
+	double TotalThinkDelay = 0.0;
+	double MaxThinkDelay = 0.0;
+};
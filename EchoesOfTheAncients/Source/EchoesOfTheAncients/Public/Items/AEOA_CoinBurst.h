@@ -0,0 +1,154 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the AAEOA_CoinBurst class, a single actor that spills many coins
+// as instances of one instanced static mesh in Echoes of the Ancients.
+// Coins follow simple ballistic motion, settle on the ground, and are collected by distance to Aria.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AEOA_CoinBurst.generated.h"
+
+class AAriaCharacter;
+class UInstancedStaticMeshComponent;
+class USoundBase;
+
+/**
+ * Lightweight replacement for spawning dozens of AAEOA_Treasure actors.
+ * Each coin is an instance with its state kept in parallel arrays, so a 200-coin
+ * drop costs one actor, one component and one draw call.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API AAEOA_CoinBurst : public AActor
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Constructor for AAEOA_CoinBurst, creates the coin instance component.
+	AAEOA_CoinBurst();
+
+	/// Simulates the airborne coins and collects the ones within reach of Aria.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Spills NumCoins coins from the actor’s location with random upward velocities.
+	/// Called automatically in BeginPlay when bBurstOnBeginPlay is set.
+	UFUNCTION(BlueprintCallable, Category = "Coin Burst")
+	void Burst();
+
+	/// Gets the number of coins still waiting to be collected.
+	/// @return int32 The number of remaining coins.
+	UFUNCTION(BlueprintPure, Category = "Coin Burst")
+	int32 GetNumCoins() const { return Positions.Num(); }
+
+protected:
+
+	/// Called when the game starts or when spawned, bursts if bBurstOnBeginPlay is set.
+	virtual void BeginPlay() override;
+
+	/// Called when the burst is removed from the world, takes its uncollected coins out of the coin stat.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/// Instanced mesh holding one instance per coin, mesh and material set in the default Blueprint.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	UInstancedStaticMeshComponent* CoinInstances;
+
+private:
+
+	/// Integrates the airborne coins and bounces them off the ground until they settle.
+	/// @return bool True if any coin moved this frame.
+	bool SimulateCoins(float DeltaTime);
+
+	/// Collects every coin within CollectRadius of Aria.
+	void CollectCoins(AAriaCharacter* AriaCharacter);
+
+	/// Removes the coin at the given index, swapping the last coin into its slot like the instance component does.
+	void RemoveCoin(int32 Index);
+
+	/// Number of coins spilled by Burst.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst",
+		meta = (ClampMin = "1", ClampMax = "1000", ToolTip = "Number of coins spilled when the burst triggers."))
+	int32 NumCoins = 50;
+
+	/// Whether the burst triggers as soon as the actor begins play.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst",
+		meta = (ToolTip = "Spill the coins as soon as the actor is spawned; disable to trigger Burst from a Blueprint."))
+	bool bBurstOnBeginPlay = true;
+
+	/// Range of horizontal launch speeds in Unreal units per second.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Motion",
+		meta = (ToolTip = "Minimum and maximum horizontal launch speed of a coin in Unreal units per second."))
+	FVector2D HorizontalSpeed = FVector2D(80.f, 260.f);
+
+	/// Range of vertical launch speeds in Unreal units per second.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Motion",
+		meta = (ToolTip = "Minimum and maximum upward launch speed of a coin in Unreal units per second."))
+	FVector2D VerticalSpeed = FVector2D(300.f, 550.f);
+
+	/// Downward acceleration applied to airborne coins.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Motion",
+		meta = (ToolTip = "Gravity applied to airborne coins in Unreal units per second squared."))
+	float Gravity = 980.f;
+
+	/// Fraction of vertical speed kept after a bounce.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Motion",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Fraction of vertical speed kept when a coin bounces off the ground."))
+	float Restitution = 0.35f;
+
+	/// Fraction of horizontal speed kept after a bounce.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Motion",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Fraction of horizontal speed kept when a coin bounces off the ground."))
+	float Friction = 0.6f;
+
+	/// Vertical speed below which a bouncing coin comes to rest.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Motion",
+		meta = (ToolTip = "A bouncing coin settles once its vertical speed drops below this value (Unreal units per second)."))
+	float SettleSpeed = 60.f;
+
+	/// Height of a settled coin above the ground.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Motion",
+		meta = (ToolTip = "Height of a resting coin’s pivot above the ground in Unreal units."))
+	float RestHeight = 2.f;
+
+	/// Distance from Aria within which a coin is collected.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Pickup",
+		meta = (ToolTip = "Horizontal distance from Aria within which a coin is collected, in Unreal units."))
+	float CollectRadius = 70.f;
+
+	/// Delay before freshly spilled coins can be collected, so the burst is visible.
+	UPROPERTY(EditAnywhere, Category = "Coin Burst|Pickup",
+		meta = (ToolTip = "Seconds after the burst before any coin can be collected."))
+	float CollectDelay = 0.4f;
+
+	/// Sound to play when coins are collected, at most once per frame.
+	UPROPERTY(EditAnywhere, Category = "Sounds",
+		meta = (ToolTip = "Sound to play when coins are picked up, set in the default Blueprint (e.g., a coin rustling sound)."))
+	USoundBase* PickupSound;
+
+	/// Identifies if these coins are Dawnspire coins, counted by AAriaCharacter when collected.
+	UPROPERTY(EditAnywhere, Category = "Treasure Properties",
+		meta = (ToolTip = "Identifies if these coins are Dawnspire coins, used for collection counting."))
+	bool IsDawnspire;
+
+	/// World location of each coin.
+	TArray<FVector> Positions;
+
+	/// World velocity of each coin, zero once settled.
+	TArray<FVector> Velocities;
+
+	/// Yaw of each coin in degrees, spun while airborne.
+	TArray<float> Yaws;
+
+	/// Scratch buffer of instance transforms uploaded while coins are moving.
+	TArray<FTransform> InstanceTransforms;
+
+	/// Height of the ground under the burst, found with one trace when it triggers.
+	double GroundZ = 0.0;
+
+	/// World time at which the burst triggered.
+	double BurstTime = 0.0;
+
+	/// Number of coins still airborne or bouncing.
+	int32 NumMoving = 0;
+};
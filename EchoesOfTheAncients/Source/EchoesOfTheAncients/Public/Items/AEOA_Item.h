@@ -1,7 +1,7 @@
 // Copyright © 2025 Kdean Games. All Rights Reserved
 // Defines the AAEOA_Item class, a base class for items in 
 // Echoes of the Ancients (AEOA) that can be interacted with,
-// including overlap events and dynamic motion effects (bobbing and rotation).
+// including pickup proximity and dynamic motion effects (bobbing and rotation).
 
 #pragma once
 
@@ -11,15 +11,20 @@
 #include "AEOA_Item.generated.h"
 
 // Forward declaration to avoid including the full header, improving compile-time efficiency.
+class AAriaCharacter;
 class UNiagaraComponent;
 class USphereComponent;
+class UAEOA_ItemEffectSubsystem;
+class UAEOA_ItemHoverSubsystem;
+class UAEOA_PickupGridSubsystem;
 
 // Enum class defining possible states for an item, 
-// used to manage its behavior (e.g., hovering or equipped).
+// used to manage its behavior (e.g., hovering, equipped or parked in a pickup pool).
 enum class EItemState : uint8
 {
     EIS_Hovering,
-    EIS_Equipped
+    EIS_Equipped,
+    EIS_Pooled
 };
 
 UCLASS()
@@ -31,24 +36,44 @@ public:
     /// Constructor for AEOA_Item, initializes actor properties.
     AAEOA_Item();
 
-    /// Called every frame, updates actor state.
-    virtual void Tick(float DeltaTime) override;
+    /// Gets the item’s current state (e.g., hovering or equipped).
+    /// @return EItemState The current state of the item.
+    FORCEINLINE EItemState GetItemState() const { return ItemState; }
+
+    /// Called by UAEOA_PickupPoolSubsystem when the item is handed out, shows it and starts hovering.
+    virtual void OnAcquiredFromPool();
+
+    /// Called by UAEOA_PickupPoolSubsystem when the item is parked, hides it and disables its collision.
+    virtual void OnReleasedToPool();
+
+    /// Called by Aria each frame while she is within reach of the item, best candidates first.
+    /// @param AriaCharacter The character within reach.
+    /// @return bool True if the item consumed the contact (e.g., treasure collected on touch),
+    /// false if it should be offered to PickupItem instead.
+    virtual bool HandlePickupProximity(AAriaCharacter* AriaCharacter);
 
 protected:
 
-    /// Called when the game starts or when spawned.
+    /// Called when the game starts or when spawned, starts hovering if the item is in the hovering state.
     virtual void BeginPlay() override;
 
+    /// Called when the item is removed from the world, stops hovering.
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /// Changes the item’s state, registering or unregistering it with the item subsystems as needed.
+    /// @param NewState The state to switch to (e.g., EIS_Equipped stops the hover animation and the SpectralxAI effect).
+    void SetItemState(EItemState NewState);
+
     /// Returns the transformed sine value based on 
-    /// RunningTime and TimeConstant for vertical bobbing motion.
-    /// @return float The transformed sine value (Amplitude * Sin(RunningTime * TimeConstant)).
-    UFUNCTION(BlueprintPure, meta = (ToolTip = "Returns transformed sine value: Amplitude * Sin(RunningTime * TimeConstant) for motion calculations"))
+    /// the item’s lifetime and TimeConstant for vertical bobbing motion.
+    /// @return float The transformed sine value (Amplitude * Sin(GameTimeSinceCreation * TimeConstant)).
+    UFUNCTION(BlueprintPure, meta = (ToolTip = "Returns transformed sine value: Amplitude * Sin(GameTimeSinceCreation * TimeConstant) for motion calculations"))
     float TransformedSin();
 
     /// Returns the transformed cosine value based on 
-    /// RunningTime and TimeConstant for potential horizontal motion.
-    /// @return float The transformed cosine value (Amplitude * Cos(RunningTime * TimeConstant)).
-    UFUNCTION(BlueprintPure, meta = (ToolTip = "Returns transformed cosine value: Amplitude * Cos(RunningTime * TimeConstant) for motion calculations"))
+    /// the item’s lifetime and TimeConstant for potential horizontal motion.
+    /// @return float The transformed cosine value (Amplitude * Cos(GameTimeSinceCreation * TimeConstant)).
+    UFUNCTION(BlueprintPure, meta = (ToolTip = "Returns transformed cosine value: Amplitude * Cos(GameTimeSinceCreation * TimeConstant) for motion calculations"))
     float TransformedCos();
 
     /// Template function to compute the average of two values of type T.
@@ -58,59 +83,35 @@ protected:
     template<typename T>
     T Avg(T First, T Second);
 
-    // Callback function for the OnComponentBeginOverlap delegate on the Sphere component.
-    // Triggered when another actor begins overlapping with the Sphere, 
-    // printing the overlapping actor's name.
-    // Parameters match the delegate signature defined in UPrimitiveComponent.
-    UFUNCTION()
-    virtual void OnSphereOverlap(
-        UPrimitiveComponent* OverlappedComponent,   // Pointer to the Sphere component on this actor that was overlapped
-        AActor* OtherActor,                         // Pointer to the actor that overlapped with this component (e.g., player)
-        UPrimitiveComponent* OtherComp,             // Pointer to the component on the other actor (e.g., player's capsule)
-        int32 OtherBodyIndex,                       // Index of the physics body on the other actor (if applicable)
-        bool bFromSweep,                            // True if the overlap resulted from a sweep (movement check)
-        const FHitResult& SweepResult               // Reference to hit result data if bFromSweep is true
-    );
-
-    // Callback function for the OnComponentEndOverlap delegate on the Sphere component.
-    // Triggered when another actor stops overlapping with the Sphere, printing a message with the actor's name.
-    // Parameters match the delegate signature defined in UPrimitiveComponent.
-    UFUNCTION()
-    virtual void OnSphereEndOverlap(
-        UPrimitiveComponent* OverlappedComponent,   // Pointer to the Sphere component on this actor that stopped overlapping
-        AActor* OtherActor,                         // Pointer to the actor that stopped overlapping (e.g., player)
-        UPrimitiveComponent* OtherComp,             // Pointer to the component on the other actor (e.g., player's capsule)
-        int32 OtherBodyIndex                        // Index of the physics body on the other actor (if applicable)
-    );
-
     /// Pointer to the static mesh component representing the item’s visual representation.
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
     UStaticMeshComponent* ItemMesh;  // Exposed for Blueprint visibility, mesh set in BP
 
-    // Sphere component used for detecting overlaps with other actors (e.g., the player).
+    // Sphere component defining the pickup radius, hashed by UAEOA_PickupGridSubsystem; it generates no overlap events.
     UPROPERTY(VisibleAnywhere)
     USphereComponent* Sphere;
 
     /// Tracks the item’s current state (e.g., hovering or equipped), 
-    /// accessible to derived classes.
+    /// accessible to derived classes. Change it through SetItemState.
     EItemState ItemState = EItemState::EIS_Hovering;
 
-    /// Amplitude of item bobbing, adjustable at runtime (Unreal units: 1 uu = 1 cm).
+    /// Amplitude of item bobbing, read when the item starts hovering (Unreal units: 1 uu = 1 cm).
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Motion|Bobbing",
-        meta = (ToolTip = "Height of item bobbing in Unreal units (1 uu = 1 cm), adjustable at runtime"))
-    float Amplitude = 0.25f;
+        meta = (ToolTip = "Height of item bobbing above and below its rest position in Unreal units (1 uu = 1 cm), read when the item starts hovering"))
+    float Amplitude = 4.75f;
 
-    /// Time constant for bobbing speed, adjustable at runtime (period = 2π/TimeConstant seconds).
+    /// Time constant for bobbing speed, read when the item starts hovering (period = 2π/TimeConstant seconds).
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Motion|Bobbing",
-        meta = (ToolTip = "Speed factor for bobbing; period = 2π/TimeConstant seconds, adjustable at runtime"))
+        meta = (ToolTip = "Speed factor for bobbing; period = 2π/TimeConstant seconds, read when the item starts hovering"))
     float TimeConstant = 3.14159f;
 
-    /// Rotation speed in degrees per second, adjustable at runtime.
+    /// Rotation speed in degrees per second, read when the item starts hovering.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Motion|Rotation",
-        meta = (ToolTip = "Rotation speed in degrees per second around the Y-axis, adjustable at runtime"))
+        meta = (ToolTip = "Rotation speed in degrees per second around the vertical axis, read when the item starts hovering"))
     float RotationRate = 45.0f;
 
     /// Niagara component for the SpectralxAI effect, displays glowing embers around the item to indicate it can be picked up.
+    /// Acts as a template only: UAEOA_ItemEffectSubsystem attaches a pooled copy while the item is significant.
     UPROPERTY(EditAnywhere)
     UNiagaraComponent* SpectralxAIEffect;
 
@@ -118,10 +119,24 @@ protected:
 
 private:
 
-    /// Elapsed time since spawn, managed by Tick for sine-based bobbing (read-only).
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Motion|Bobbing",
-        meta = (AllowPrivateAccess = "true", ToolTip = "Elapsed time in seconds since spawn; increments by DeltaTime each frame to drive sine-based bobbing (read-only, managed by Tick for smooth motion)"))
-    float RunningTime;
+    friend class UAEOA_ItemEffectSubsystem;
+    friend class UAEOA_ItemHoverSubsystem;
+    friend class UAEOA_PickupGridSubsystem;
+
+    /// Registers the item with the hover, effect and pickup grid subsystems.
+    void RegisterWithItemSubsystems();
+
+    /// Unregisters the item from the hover, effect and pickup grid subsystems.
+    void UnregisterFromItemSubsystems();
+
+    /// Slot of this item in the hover subsystem’s arrays, INDEX_NONE while not hovering.
+    int32 HoverIndex = INDEX_NONE;
+
+    /// Slot of this item in the effect subsystem’s arrays, INDEX_NONE while not registered.
+    int32 EffectIndex = INDEX_NONE;
+
+    /// Slot of this item in the pickup grid subsystem’s arrays, INDEX_NONE while not hashed.
+    int32 GridIndex = INDEX_NONE;
 
 };
 
@@ -0,0 +1,92 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_ItemEffectSubsystem class, a significance manager that keeps
+// only the most relevant SpectralxAI item effects simulating.
+// Items are ranked by distance and view direction, and effects outside the budget are pooled.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_ItemEffectSubsystem.generated.h"
+
+class AAEOA_Item;
+class UNiagaraComponent;
+
+/**
+ * World subsystem that budgets the SpectralxAI effect of hovering items.
+ * Each item's SpectralxAIEffect component is only a template; the simulated effect
+ * is a pooled Niagara component attached to the item while it is significant.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_ItemEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Destroys the pooled effect components when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Re-evaluates item significance at the configured interval and moves effects in and out of the pool.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Starts budgeting the SpectralxAI effect of the item.
+	/// @param Item The item to register; ignored if it has no effect template.
+	void RegisterItem(AAEOA_Item* Item);
+
+	/// Stops budgeting the item’s effect, returning its effect component to the pool if it had one.
+	/// @param Item The item to unregister.
+	void UnregisterItem(AAEOA_Item* Item);
+
+	/// Gets the number of effects currently attached to items and simulating.
+	/// @return int32 The number of active effects.
+	UFUNCTION(BlueprintPure, Category = "Items|Effects")
+	int32 GetNumActiveEffects() const { return NumActiveEffects; }
+
+	/// Gets the number of effect components parked in the pool.
+	/// @return int32 The number of pooled effects.
+	UFUNCTION(BlueprintPure, Category = "Items|Effects")
+	int32 GetNumPooledEffects() const { return Pool.Num(); }
+
+private:
+
+	/// Ranks the registered items and grants effects to the most significant ones within the budget.
+	void UpdateSignificance();
+
+	/// Attaches a pooled effect to the item at the given index and activates it.
+	void GrantEffect(int32 Index);
+
+	/// Detaches the effect of the item at the given index and returns it to the pool.
+	void RevokeEffect(int32 Index);
+
+	/// Items being budgeted, indexed in parallel with Effects.
+	UPROPERTY()
+	TArray<AAEOA_Item*> Items;
+
+	/// Effect component granted to each item, or nullptr while the item is not significant.
+	UPROPERTY()
+	TArray<UNiagaraComponent*> Effects;
+
+	/// Deactivated, detached effect components waiting to be granted again.
+	UPROPERTY()
+	TArray<UNiagaraComponent*> Pool;
+
+	/// Scratch buffer of (score, item index) pairs, sorted each evaluation.
+	TArray<TPair<float, int32>> Ranking;
+
+	/// Scratch buffer flagging which items made the budget in the current evaluation.
+	TBitArray<> Significant;
+
+	/// Time accumulated since the last significance evaluation.
+	float TimeSinceUpdate = 0.f;
+
+	/// Number of items that currently have an effect attached.
+	int32 NumActiveEffects = 0;
+};
@@ -0,0 +1,78 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_ItemHoverSubsystem class, a world subsystem that animates
+// every hovering AAEOA_Item (bobbing and rotation) in a single batched pass.
+// Items register while hovering and drop out as soon as they are equipped.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_ItemHoverSubsystem.generated.h"
+
+class AAEOA_Item;
+
+/**
+ * World subsystem that owns the hover animation of all hovering items.
+ * Per-item data is kept as a structure of arrays, and the bob and spin are
+ * evaluated analytically from world time, so the result is independent of frame rate.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_ItemHoverSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Releases every registered item when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Evaluates the hover motion of every registered item and applies it.
+	/// @param DeltaTime Time elapsed since the last frame (unused, motion is evaluated from world time).
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Starts animating the item from its current transform.
+	/// @param Item The item to register, must not already be registered.
+	void RegisterItem(AAEOA_Item* Item);
+
+	/// Stops animating the item, leaving it at its current transform.
+	/// @param Item The item to unregister, ignored if it is not registered.
+	void UnregisterItem(AAEOA_Item* Item);
+
+	/// Gets the number of items currently animated by the subsystem.
+	/// @return int32 The number of registered items.
+	FORCEINLINE int32 GetNumItems() const { return Items.Num(); }
+
+private:
+
+	/// Items being animated, indexed in parallel with the arrays below.
+	UPROPERTY()
+	TArray<AAEOA_Item*> Items;
+
+	/// World location of each item when it started hovering.
+	TArray<FVector> BaseLocations;
+
+	/// World rotation of each item when it started hovering.
+	TArray<FQuat> BaseRotations;
+
+	/// World time at which each item started hovering, the phase origin of its bob and spin.
+	TArray<double> StartTimes;
+
+	/// Height of each bob in Unreal units.
+	TArray<float> Amplitudes;
+
+	/// Angular frequency of each bob in radians per second.
+	TArray<float> BobRates;
+
+	/// Yaw rotation speed of each item in radians per second.
+	TArray<float> RotationRates;
+
+	/// Scratch buffers filled by the evaluation pass and consumed by the apply pass.
+	TArray<float> BobAngles;
+	TArray<float> BobOffsets;
+};
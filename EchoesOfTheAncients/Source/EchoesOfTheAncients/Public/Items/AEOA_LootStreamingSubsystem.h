@@ -0,0 +1,119 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_LootStreamingSubsystem class, a world subsystem that
+// asynchronously loads the soft loot classes of breakables near the player,
+// defers loot spawns until their class is resident, and reports loot memory.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Items/AEOA_LootTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_LootStreamingSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * World subsystem streaming loot classes in and out around the player.
+ * Loot sources (e.g., breakables) register their loot table; when the player
+ * comes within the preload radius the classes are requested through the
+ * streamable manager, and they are released again once the player moves away.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_LootStreamingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Releases every streaming handle when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Re-evaluates which loot sources are in range at the configured interval.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Starts streaming the loot of the source when the player gets close.
+	/// @param Source The actor owning the loot table, its location decides when the loot is preloaded.
+	/// @param LootTable The entries the source may drop.
+	void RegisterSource(AActor* Source, const TArray<FAEOA_LootEntry>& LootTable);
+
+	/// Stops streaming the loot of the source, releasing classes no other source in range needs.
+	/// @param Source The actor to unregister.
+	void UnregisterSource(AActor* Source);
+
+	/// Spawns the loot at the given transform, immediately if its class is resident,
+	/// otherwise as soon as the asynchronous load completes. Item loot is taken from the pickup pool.
+	/// @param LootClass The class to spawn.
+	/// @param Location World location of the loot.
+	/// @param Rotation World rotation of the loot.
+	void SpawnLoot(const TSoftClassPtr<AActor>& LootClass, const FVector& Location, const FRotator& Rotation);
+
+	/// Writes the memory held by resident loot classes and the assets they reference to the log.
+	void DumpMemoryReport() const;
+
+private:
+
+	/// A registered loot source and the class paths of its table.
+	struct FLootSource
+	{
+		TWeakObjectPtr<AActor> Source;
+		FVector Location = FVector::ZeroVector;
+		TArray<FSoftObjectPath> ClassPaths;
+		bool bInRange = false;
+		bool bReserved = false;
+	};
+
+	/// Streaming state of a loot class shared by every source referencing it.
+	struct FLootClassState
+	{
+		/// Number of in-range sources referencing the class.
+		int32 NumInRange = 0;
+
+		/// Keeps the class resident while NumInRange is positive.
+		TSharedPtr<FStreamableHandle> Handle;
+	};
+
+	/// A loot spawn waiting for its class to finish loading.
+	struct FDeferredSpawn
+	{
+		FSoftObjectPath ClassPath;
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+	};
+
+	/// Moves sources in and out of range of the player, loading and releasing their classes.
+	void UpdateSources();
+
+	/// Adds or removes one in-range reference to each class of the source.
+	void SetSourceInRange(FLootSource& Source, bool bInRange);
+
+	/// Pre-warms the pickup pool with the resident item classes of the source, once.
+	void ReserveSourcePickups(FLootSource& Source);
+
+	/// Spawns the resident class at the given transform, through the pickup pool for items.
+	void SpawnResidentLoot(UClass* LootClass, const FVector& Location, const FRotator& Rotation);
+
+	/// Completion callback of a deferred spawn load.
+	void OnDeferredLootLoaded(FSoftObjectPath ClassPath);
+
+	/// Registered loot sources.
+	TArray<FLootSource> Sources;
+
+	/// Streaming state keyed by loot class path.
+	TMap<FSoftObjectPath, FLootClassState> ClassStates;
+
+	/// Spawns waiting for their class to load.
+	TArray<FDeferredSpawn> DeferredSpawns;
+
+	/// Handles of the loads requested by deferred spawns, released once the spawns run.
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> DeferredHandles;
+
+	/// Time accumulated since the last range evaluation.
+	float TimeSinceUpdate = 0.f;
+};
@@ -0,0 +1,30 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines shared loot types for Echoes of the Ancients, such as the
+// soft-referenced, weighted entries breakables roll when they break.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AEOA_LootTypes.generated.h"
+
+/// A possible drop of a loot table, referenced softly so the drop’s assets only load when needed.
+USTRUCT(BlueprintType)
+struct FAEOA_LootEntry
+{
+	GENERATED_BODY()
+
+	/// Actor class to spawn, e.g., a treasure (pooled) or a coin burst.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot",
+		meta = (ToolTip = "Actor class to spawn for this entry (e.g., BP_Coin or BP_CoinBurst). Loaded asynchronously when the player gets close."))
+	TSoftClassPtr<AActor> LootClass;
+
+	/// Relative chance of this entry among the weighted entries of the table.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot",
+		meta = (ClampMin = "0.0", EditCondition = "!bGuaranteed", ToolTip = "Relative chance of this entry among the non-guaranteed entries; one of them is rolled per break."))
+	float Weight = 1.f;
+
+	/// Whether this entry always drops, in addition to the weighted roll.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot",
+		meta = (ToolTip = "Always drop this entry, in addition to the one rolled from the weighted entries."))
+	bool bGuaranteed = false;
+};
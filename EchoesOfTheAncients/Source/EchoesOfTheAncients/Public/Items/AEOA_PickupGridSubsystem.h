@@ -0,0 +1,84 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_PickupGridSubsystem class, a world subsystem that keeps
+// the positions of hovering pickups in a static spatial hash.
+// Aria queries it once per frame instead of relying on per-item sphere overlap events.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_PickupGridSubsystem.generated.h"
+
+class AAEOA_Item;
+
+/**
+ * World subsystem hashing hovering items into a 2D grid of cells on the XY plane.
+ * Items never move while hovering, so a pickup is hashed once when it starts hovering
+ * and removed when it is equipped, pooled or destroyed. A query only visits the
+ * handful of cells around the querier, nearest first, and scores a bounded number of pickups in reach.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_PickupGridSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Reads the cell size once; changing it later only affects newly created worlds.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/// Releases every registered item when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Hashes the item at its current location, using its Sphere radius as pickup radius.
+	/// @param Item The item to register, ignored if it is already registered.
+	void RegisterItem(AAEOA_Item* Item);
+
+	/// Removes the item from the grid.
+	/// @param Item The item to unregister, ignored if it is not registered.
+	void UnregisterItem(AAEOA_Item* Item);
+
+	/// Finds the pickups whose radius reaches the querier, best first.
+	/// Candidates are ranked by distance, scaled up for pickups away from the facing direction.
+	/// @param Location World location of the querier (e.g., Aria’s capsule center).
+	/// @param Forward Facing direction of the querier, used to prefer pickups in front.
+	/// @param QueryRadius Horizontal radius of the querier, added to each pickup’s radius (e.g., the capsule radius).
+	/// @param QueryHalfHeight Vertical half extent of the querier, added to each pickup’s radius (e.g., the capsule half height).
+	/// @param MaxCandidates Maximum number of candidates to return.
+	/// @param OutCandidates Receives the candidates, best first.
+	void QueryCandidates(const FVector& Location, const FVector& Forward, float QueryRadius, float QueryHalfHeight, int32 MaxCandidates, TArray<AAEOA_Item*, TInlineAllocator<4>>& OutCandidates) const;
+
+	/// Gets the number of items currently hashed in the grid.
+	/// @return int32 The number of registered items.
+	FORCEINLINE int32 GetNumItems() const { return Items.Num(); }
+
+private:
+
+	/// Computes the cell containing the given location.
+	FIntPoint GetCellKey(const FVector& Location) const;
+
+	/// Items in the grid, indexed in parallel with the arrays below.
+	UPROPERTY()
+	TArray<AAEOA_Item*> Items;
+
+	/// World location of each item when it was hashed.
+	TArray<FVector> Locations;
+
+	/// Pickup radius of each item in Unreal units.
+	TArray<float> Radii;
+
+	/// Cell each item was hashed into.
+	TArray<FIntPoint> CellKeys;
+
+	/// Item slots contained in each non-empty cell.
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> Cells;
+
+	/// Edge length of a cell in Unreal units.
+	float CellSize = 250.f;
+
+	/// Largest pickup radius registered so far, bounds the cells visited by a query.
+	float MaxItemRadius = 0.f;
+};
@@ -0,0 +1,83 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_PickupPoolSubsystem class, a world subsystem that recycles
+// pickup actors (e.g., AAEOA_Treasure) instead of spawning and destroying them.
+// Pools are pre-warmed per class at level load and report hit and miss rates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AEOA_PickupPoolSubsystem.generated.h"
+
+class AAEOA_Item;
+
+/// Pooled instances and usage counters for a single pickup class.
+USTRUCT()
+struct FAEOA_PickupPool
+{
+	GENERATED_BODY()
+
+	/// Dormant instances ready to be handed out.
+	UPROPERTY()
+	TArray<AAEOA_Item*> Available;
+
+	/// Number of instances requested through ReservePickups, the target size of the pool.
+	int32 Reserved = 0;
+
+	/// Number of instances of this class spawned by the pool, pre-warmed or on a miss.
+	int32 Spawned = 0;
+
+	/// Number of acquisitions served from Available.
+	int32 Hits = 0;
+
+	/// Number of acquisitions that had to spawn a new instance.
+	int32 Misses = 0;
+};
+
+/**
+ * World subsystem pooling pickup actors per class.
+ * Breakables reserve instances when they begin play, acquire one when they break,
+ * and pickups release themselves back to the pool when collected.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_PickupPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Clears the pools when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Grows the pool of the given class by Count dormant instances, spawning them immediately.
+	/// @param PickupClass The pickup class to pre-warm (e.g., BP_Coin).
+	/// @param Count The number of additional instances to keep ready.
+	void ReservePickups(TSubclassOf<AAEOA_Item> PickupClass, int32 Count = 1);
+
+	/// Hands out a pickup of the given class at the given transform, spawning one if the pool is empty.
+	/// @param PickupClass The pickup class to acquire.
+	/// @param Location World location of the pickup.
+	/// @param Rotation World rotation of the pickup.
+	/// @return AAEOA_Item* The active pickup, or nullptr if it could not be spawned.
+	AAEOA_Item* AcquirePickup(TSubclassOf<AAEOA_Item> PickupClass, const FVector& Location, const FRotator& Rotation);
+
+	/// Returns a collected pickup to the pool of its class, hiding it and disabling its collision.
+	/// Level-placed pickups are accepted too and become available to later acquisitions.
+	/// @param Pickup The pickup to release.
+	void ReleasePickup(AAEOA_Item* Pickup);
+
+	/// Writes the per-class pool sizes and hit rates to the log.
+	void DumpStats() const;
+
+private:
+
+	/// Spawns a dormant instance of the given class for the pool.
+	AAEOA_Item* SpawnPooledPickup(UClass* PickupClass);
+
+	/// Pools keyed by pickup class.
+	UPROPERTY()
+	TMap<UClass*, FAEOA_PickupPool> Pools;
+};
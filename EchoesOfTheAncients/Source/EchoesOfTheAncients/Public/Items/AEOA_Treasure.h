@@ -1,7 +1,7 @@
 // Copyright © 2025 Kdean Games. All Rights Reserved
 // Defines the AEOA_Treasure class, a child of AEOA_Item, 
 // representing treasure pickups in Echoes of the Ancients.
-// Plays a pickup sound and destroys itself when overlapped by the player character.
+// Plays a pickup sound and returns itself to the pickup pool when the player character reaches it.
 
 #pragma once
 
@@ -19,10 +19,12 @@ class ECHOESOFTHEANCIENTS_API AAEOA_Treasure : public AAEOA_Item
 {
 	GENERATED_BODY()
 	
-protected:
-    /// Called when the Sphere component begins overlapping with another actor, 
-    /// plays a pickup sound and destroys the treasure.
-    virtual void OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult) override;
+public:
+    /// Called when Aria comes within reach of the treasure, 
+    /// plays a pickup sound and releases the treasure to UAEOA_PickupPoolSubsystem.
+    /// @param AriaCharacter The character collecting the treasure.
+    /// @return bool Always true, treasure is collected on touch.
+    virtual bool HandlePickupProximity(AAriaCharacter* AriaCharacter) override;
 
 private:
     UPROPERTY(EditAnywhere, Category = "Sounds",
@@ -7,17 +7,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Combat/AEOA_StatusEffectSubsystem.h"
+#include "Combat/AEOA_SwingHitRegistry.h"
 #include "Items/AEOA_Item.h"
 #include "AEOA_Weapon.generated.h"
 
 // Forward declarations to minimize header dependencies
+class UAEOA_BladeTrajectoryAsset;
 class UBoxComponent;
 class USceneComponent;
 class USoundBase;
 
 /**
  * AAEOA_Weapon class representing a weapon item that can be equipped and used for combat.
- * Inherits from AAEOA_Item to leverage overlap detection and motion effects.
+ * Inherits from AAEOA_Item to leverage pickup detection and motion effects.
  */
 UCLASS()
 class ECHOESOFTHEANCIENTS_API AAEOA_Weapon : public AAEOA_Item
@@ -29,6 +32,16 @@ public:
     /// Constructor for AAEOA_Weapon, initializes weapon properties and components.
     AAEOA_Weapon();
 
+    /// Sweeps the blade between its previous and current pose while the collision window is open.
+    /// Only ticks during the window, after animation has moved the blade.
+    /// @param DeltaTime Time elapsed since the last frame.
+    virtual void Tick(float DeltaTime) override;
+
+    /// Opens or closes the weapon’s collision window (e.g., from attack montage notifies).
+    /// In continuous mode the blade is swept every frame; otherwise the WeaponBox collision is toggled.
+    /// @param CollisionEnabled NoCollision closes the window, any other value opens it.
+    void SetCollisionWindowEnabled(ECollisionEnabled::Type CollisionEnabled);
+
     /// Equips the weapon by attaching it to the specified parent component and socket, setting owner and instigator.
     /// @param InParent The parent component to attach the weapon to (e.g., Aria’s skeletal mesh).
     /// @param InSocketName The name of the socket to attach the weapon to (e.g., "R_hand_weapon").
@@ -41,32 +54,37 @@ public:
     /// @param InSocketName The name of the socket to attach the weapon to (e.g., "R_hand_weapon" or "SpineSocket")
     void AttachMeshToSocket(USceneComponent* InParent, const FName& InSocketName);
 
-    /// Array of actors to ignore during box traces to prevent multiple hits per swing.
-    TArray<AActor*> IgnoreActors;
+    /// Receives the hits of a sweep queued with UAEOA_CombatTraceSubsystem and processes them in order.
+    /// @param InSwingId The swing the sweep was queued for; hits of an older swing are ignored.
+    /// @param Hits The hits of the sweep, sorted by time.
+    void ReceiveSweepHits(int32 InSwingId, TConstArrayView<FHitResult> Hits);
 
 protected:
 
     /// Called when the game starts or when spawned, binds overlap events for the WeaponBox.
     virtual void BeginPlay() override;
 
-    /// Overridden function called when the Sphere component begins overlapping with another actor.
-    /// Calls the parent (AItem) version to maintain inherited behavior, extensible for weapon-specific actions.
-    virtual void OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult) override;
-
-    /// Overridden function called when the Sphere component stops overlapping with another actor.
-    /// Calls the parent (AItem) version to maintain inherited behavior, extensible for weapon-specific actions.
-    virtual void OnSphereEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex) override;
-
     /// Callback for when the WeaponBox begins overlapping with another actor, performing a box trace to detect the impact point.
     UFUNCTION()
     void OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+    /// Queues a blade hit for the combat resolution pass, once per actor per swing.
+    /// @param Hit The hit on the struck actor.
+    void ProcessBladeHit(const FHitResult& Hit);
+
     /// Blueprint-implementable event to create Field System fields at the specified location.
+    /// Only called when native fields are disabled (AEOA.Fields.Native 0).
     UFUNCTION(BlueprintImplementableEvent)
     void CreateFields(const FVector& FieldLocation);
 
+    /// Breaks geometry collections at a resolved hit, through UAEOA_FieldApplicationSubsystem or CreateFields as a fallback.
+    /// @param ImpactPoint World location of the hit.
+    void ApplyHitFields(const FVector& ImpactPoint);
+
 private:
 
+    friend class UAEOA_CombatResolutionSubsystem;
+
     /// Sound to play when equipping the weapon, editable in Blueprints.
     UPROPERTY(EditAnywhere, Category = "Weapon Properties",
         meta = (ToolTip = "Sound to play when equipping the weapon, set in the default Blueprint (e.g., a chink sound for a sword)."))
@@ -87,10 +105,71 @@ private:
         meta = (ToolTip = "Scene component marking the end point of the box trace, positioned at the tip of the blade. Adjust in Blueprints to align with the blade’s geometry."))
     USceneComponent* BoxTraceEnd;
 
+    /// Queues sweeps of interpolated blade poses from the previous frame to the current one, in swing order.
+    void SweepBlade();
+
+    /// Gets the blade base and tip for this frame, from the baked trajectory while its montage plays, otherwise from BoxTraceStart and BoxTraceEnd.
+    /// @param OutStart World location of the blade base.
+    /// @param OutEnd World location of the blade tip.
+    void GetBladePose(FVector& OutStart, FVector& OutEnd) const;
+
+    /// Rebuilds the blade from BladeTrajectory, transformed by the wielder’s mesh.
+    /// @return bool True if the wielder plays a baked section of the trajectory montage.
+    bool GetBakedBladePose(FVector& OutStart, FVector& OutEnd) const;
+
+    /// Queues a sweep of the blade box from one pose to the next with UAEOA_CombatTraceSubsystem.
+    void SweepBladeStep(const FVector& FromStart, const FVector& FromEnd, const FVector& ToStart, const FVector& ToEnd);
+
+    /// Whether the blade is swept every frame of the collision window instead of relying on WeaponBox overlaps.
+    UPROPERTY(EditAnywhere, Category = "Weapon Properties|Collision",
+        meta = (ToolTip = "Sweep the blade between frames while the collision window is open. Disable to fall back to WeaponBox overlap events and a single box trace."))
+    bool bContinuousCollision = true;
+
+    /// Half thickness of the swept blade box in Unreal units.
+    UPROPERTY(EditAnywhere, Category = "Weapon Properties|Collision",
+        meta = (ClampMin = "0.5", ToolTip = "Half thickness of the box swept along the blade, in Unreal units."))
+    float BladeHalfThickness = 5.f;
+
+    /// Baked socket trajectory of the wielder’s attack montage, used instead of the animated blade components.
+    UPROPERTY(EditAnywhere, Category = "Weapon Properties|Collision",
+        meta = (ToolTip = "Baked blade trajectory of the attack montage (e.g., DA_BladeTrajectory_OneHanded). While its montage plays, the blade is rebuilt from the bake and the wielder’s mesh transform, so hits do not depend on the pose being evaluated."))
+    UAEOA_BladeTrajectoryAsset* BladeTrajectory;
+
+    /// Blade base and tip positions at the end of the previous sweep.
+    FVector PreviousBladeStart = FVector::ZeroVector;
+    FVector PreviousBladeEnd = FVector::ZeroVector;
+
+    /// Whether PreviousBladeStart and PreviousBladeEnd hold a pose of the current window.
+    bool bHasPreviousBladePose = false;
+
+    /// Swing id, actors already hit this swing and the query params reused by every trace of the swing.
+    /// A new swing starts each time a collision window opens, so every combo section hits a target at most once.
+    FAEOA_SwingHitRegistry HitRegistry;
+
+    /// Radius of the fields applied where the weapon hits.
+    UPROPERTY(EditAnywhere, Category = "Weapon Properties|Fields",
+        meta = (ClampMin = "1.0", ToolTip = "Radius of the strain and force fields applied at each hit, in Unreal units. Geometry collections outside it are not affected."))
+    float FieldRadius = 50.f;
+
+    /// External strain applied by the fields, breaking clusters whose damage threshold it exceeds.
+    UPROPERTY(EditAnywhere, Category = "Weapon Properties|Fields",
+        meta = (ClampMin = "0.0", ToolTip = "External strain applied at each hit. Must exceed the damage threshold of the geometry collection (e.g., GC_WoodenCrate) to break it."))
+    float FieldStrain = 500000.f;
+
+    /// Radial force pushing the broken pieces away from the hit.
+    UPROPERTY(EditAnywhere, Category = "Weapon Properties|Fields",
+        meta = (ClampMin = "0.0", ToolTip = "Radial force pushing broken pieces away from the hit."))
+    float FieldImpulse = 1000000.f;
+
     /// Amount of damage the weapon deals per hit, editable in Blueprints.
     UPROPERTY(EditAnywhere, Category = "Weapon Properties")
     float Damage = 20.f;
 
+    /// Status effects applied to every victim the weapon damages, e.g., a bleed for a serrated blade.
+    UPROPERTY(EditAnywhere, Category = "Weapon Properties",
+        meta = (ToolTip = "Status effects applied to each victim the weapon damages (e.g., Bleed, Burn or Slow)."))
+    TArray<FAEOA_StatusEffectSpec> HitEffects;
+
 public:
     /// Gets the WeaponBox component for collision detection.
     /// @return UBoxComponent* The WeaponBox component attached to this weapon.
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "AudioParameter.h"
 #include "MetasoundSource.h" // Include for UMetaSoundSource
 #include "AnimNotifyState_PlayMetaSound.generated.h"
 
@@ -33,4 +34,20 @@ public:
     UPROPERTY(EditAnywhere, Category = "Aria|SFX",
         meta = (ToolTip = "Reference to the MetaSound asset to play during the animation (e.g., SFX_Woosh)."))
     class UMetaSoundSource* MetaSound;
+
+    /// Resolves the sound parameters of SectionName once the notify is loaded.
+    virtual void PostLoad() override;
+
+#if WITH_EDITOR
+    /// Resolves the sound parameters again when SectionName is edited.
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+    /// Builds SwingParameters from the swing data of SectionName.
+    void BuildSwingParameters();
+
+    /// Panning, duration and pitch parameters of the section, built once and sent in a single call per swing.
+    TArray<FAudioParameter> SwingParameters;
 };
@@ -0,0 +1,85 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the UAEOA_HealthBarSubsystem class, a world subsystem that keeps
+// a flat list of actor health bars and draws the visible ones through a
+// single viewport layer, replacing one widget component per enemy.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UI/HUD/SAEOA_HealthBarLayer.h"
+#include "AEOA_HealthBarSubsystem.generated.h"
+
+/**
+ * World subsystem owning every actor health bar.
+ * Actors allocate a slot the first time their bar is shown and address it by index afterwards.
+ * Each frame the visible slots are projected to the screen in one pass and handed to SAEOA_HealthBarLayer,
+ * which paints them all; size and draw distance are console variables under AEOA.HealthBars.
+ */
+UCLASS()
+class ECHOESOFTHEANCIENTS_API UAEOA_HealthBarSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/// Only create the subsystem for game and PIE worlds.
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/// Adds the health bar layer to the game viewport.
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/// Removes the layer and drops every slot when the world is torn down.
+	virtual void Deinitialize() override;
+
+	/// Projects the visible bars and hands them to the layer.
+	/// @param DeltaTime Time elapsed since the last frame.
+	virtual void Tick(float DeltaTime) override;
+
+	/// Returns the stat id used to profile the subsystem tick.
+	virtual TStatId GetStatId() const override;
+
+	/// Allocates a hidden health bar slot following an actor.
+	/// @param Owner The actor the bar floats above.
+	/// @param Offset Offset of the bar from the actor’s location, in world space.
+	/// @return int32 The slot index, to be released with ReleaseBar.
+	int32 AllocateBar(AActor* Owner, const FVector& Offset);
+
+	/// Frees a slot for reuse by another actor.
+	/// @param Slot The slot returned by AllocateBar.
+	void ReleaseBar(int32 Slot);
+
+	/// Shows or hides a bar.
+	/// @param Slot The slot returned by AllocateBar.
+	/// @param bVisible Whether the bar is drawn.
+	void SetBarVisible(int32 Slot, bool bVisible);
+
+	/// Sets the fill of a bar.
+	/// @param Slot The slot returned by AllocateBar.
+	/// @param Percent The fill, from 0 to 1.
+	void SetBarPercent(int32 Slot, float Percent);
+
+private:
+
+	/// Actor followed by each slot, nullptr for free slots.
+	UPROPERTY()
+	TArray<AActor*> Owners;
+
+	/// World offset of each slot from its actor.
+	TArray<FVector> Offsets;
+
+	/// Fill of each slot.
+	TArray<float> Percents;
+
+	/// Whether each slot is drawn.
+	TArray<bool> Visible;
+
+	/// Indices of the free slots.
+	TArray<int32> FreeSlots;
+
+	/// Bars projected this frame, swapped with the layer's bars of the previous frame.
+	TArray<FAEOA_HealthBarDrawItem> DrawItems;
+
+	/// Viewport layer painting the bars.
+	TSharedPtr<SAEOA_HealthBarLayer> Layer;
+};
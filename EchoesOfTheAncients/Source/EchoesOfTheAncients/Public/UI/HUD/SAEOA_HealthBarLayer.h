@@ -0,0 +1,54 @@
+// Copyright © 2025 Kdean Games. All Rights Reserved
+// Defines the SAEOA_HealthBarLayer class, a Slate leaf widget covering
+// the game viewport that paints every visible enemy health bar in one pass.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Brushes/SlateColorBrush.h"
+#include "Widgets/SLeafWidget.h"
+
+/// A health bar to paint, at its screen position in viewport pixels.
+struct FAEOA_HealthBarDrawItem
+{
+	FVector2f ScreenPosition = FVector2f::ZeroVector;
+	float Percent = 1.f;
+};
+
+/**
+ * Viewport-sized, hit-test invisible widget drawing the health bars listed by UAEOA_HealthBarSubsystem.
+ * Every bar is two boxes (background and fill) of one shared brush, so Slate batches the whole layer
+ * into a couple of draw calls regardless of the number of bars.
+ */
+class ECHOESOFTHEANCIENTS_API SAEOA_HealthBarLayer : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SAEOA_HealthBarLayer) {}
+	SLATE_END_ARGS()
+
+	/// Constructs the layer, which paints nothing until bars are set.
+	void Construct(const FArguments& InArgs);
+
+	/// Replaces the bars to paint by swapping arrays, leaving the previous bars in InBars for reuse.
+	/// @param InBars The bars to paint, centered on their screen position.
+	/// @param InBarSize Size of a bar, in viewport pixels.
+	void SwapBars(TArray<FAEOA_HealthBarDrawItem>& InBars, const FVector2f& InBarSize);
+
+	/// Paints the background and fill of every bar.
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	/// The layer fills the viewport slot it is added to and asks for no size of its own.
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+
+	/// Bars painted on the next frame.
+	TArray<FAEOA_HealthBarDrawItem> Bars;
+
+	/// Size of a bar, in viewport pixels.
+	FVector2f BarSize = FVector2f::ZeroVector;
+
+	/// White brush shared by every box, tinted per element.
+	FSlateColorBrush Brush = FSlateColorBrush(FLinearColor::White);
+};